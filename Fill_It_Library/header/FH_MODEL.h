@@ -5,19 +5,54 @@
 
 #include <string>
 #include <fstream>
+#include <vector>
+#include <set>
+#include <map>
+
+//	A fastener side prepared for FH results and the options its results are generated with
+class FH_Fastener
+{
+	public:
+		CBUSH* bush;
+		CBUSH* other_bush;		///< CBUSH on the other side of the plate, NULL if there is none
+		int side_no;
+		bool mat_flag;
+		bool as_is;
+		unsigned int axis[2];
+};
 
 class FH_MODEL: public BASIC_MODEL
 {
 	public:
+		FH_MODEL();
 		FH_MODEL(std::string fileName);
+		FH_MODEL(std::string fileName, BDF_Profile profile);
+		FH_MODEL(std::string fileName, BDF_Profile profile, BDF_Region region);
 		void generate_FH_List();
+		//	Adds the CBUSHes at the fastener nodes and the CQUADs within rings of them to a punch filter, no nodes selects every fastener
+		void select_FH_results(std::vector<unsigned long> &Nodes, int Rings, Punch_Filter &filter);
 		void calculate_FH_elements(std::vector<unsigned long> &NODE_List, std::vector<unsigned int> &Axis_List_1, 
 				std::vector<unsigned int> &Axis_List_2, std::vector<int> &Iterations, bool &Composite, 
 				std::vector<bool> &Mat_Orientation, std::vector<bool> &AS_IS, std::vector<unsigned long> &Axis_Check);
+		//	Finds the FH elements of the selected fasteners without generating results, each fastener side is prepared once until the results are streamed
+		void prepare_FH_elements(std::vector<unsigned long> &NODE_List, std::vector<unsigned int> &Axis_List_1, 
+				std::vector<unsigned int> &Axis_List_2, std::vector<int> &Iterations, bool &Composite, 
+				std::vector<bool> &Mat_Orientation, std::vector<bool> &AS_IS, std::vector<unsigned long> &Axis_Check);
+		//	Generates the FH results of the prepared fasteners for one subcase from the results held by the model
+		void calculate_FH_subcase(unsigned long SubcaseID);
+		/*	Reads the results files one subcase at a time and generates the FH results of the prepared fasteners for
+			each subcase before the next is read, element results of only one subcase are held at a time. A subcase
+			whose results could not be read again is reported and removed, it is not written. Returns false if the
+			files cannot be streamed */
+		bool stream_FH_results(std::vector<std::string> &fileNames);
 		void generate_FH_output(std::string output_file, std::vector<unsigned long> &NODE_List, std::vector<unsigned long> &SUBCASE_List, 
 				std::vector<int> &Iterations, bool Composite);
 	private:
 		std::map<unsigned long, std::vector<CBUSH*> > FH_Map_Node_A, FH_Map_Node_B;
+		std::vector<FH_Fastener> FH_Fasteners;
+		std::set<std::pair<CBUSH*, int> > FH_Prepared;
+		void add_FH_fastener(std::vector<CBUSH*> &bushes, int side_no, int iterations, unsigned int axis_type, bool mat_flag, bool as_is, unsigned int axis_array[2]);
+		void clear_FH_fasteners();
 		void print_result(std::fstream &res_file, std::map<unsigned long, std::vector<CBUSH*> >::iterator &Map_it, int side_no, LOAD_CASE* Load_Case_Pointer, int &max_CQUADs);
 		std::string ulong_to_str(unsigned long Num);
 		std::string int_to_str(int Num);
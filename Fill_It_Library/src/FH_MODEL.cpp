@@ -2,26 +2,34 @@
 #include "FH_MODEL.h"
 #include "NASTRAN_General/CBUSH.h"
 #include "NASTRAN_General/BASIC_MODEL.h"
+#include "NASTRAN_General/BDF_Region.h"
+#include "NASTRAN_General/Punch_Filter.h"
+#include "NASTRAN_General/Punch_Stream.h"
 
 #include <string>
+#include <vector>
 #include <map>
+#include <set>
 #include <iostream>
 #include <fstream>
 #include <sstream>
 
-/*
 FH_MODEL::FH_MODEL() : BASIC_MODEL()
 {
 
 }
 
-FH_MODEL::FH_MODEL() : BASIC_MODEL()
+FH_MODEL::FH_MODEL(std::string fileName) : BASIC_MODEL(fileName)
 {
 
 }
-*/
 
-FH_MODEL::FH_MODEL(std::string fileName) : BASIC_MODEL(fileName)
+FH_MODEL::FH_MODEL(std::string fileName, BDF_Profile profile) : BASIC_MODEL(fileName, profile)
+{
+
+}
+
+FH_MODEL::FH_MODEL(std::string fileName, BDF_Profile profile, BDF_Region region) : BASIC_MODEL(fileName, profile, region)
 {
 
 }
@@ -57,9 +65,72 @@ void FH_MODEL::generate_FH_List()
 	}
 }
 
+void FH_MODEL::select_FH_results(std::vector<unsigned long> &Nodes, int Rings, Punch_Filter &filter)
+{
+	std::map<unsigned long, std::vector<CBUSH*> >::iterator Map_it;
+	// All fasteners are selected if no nodes are given
+	std::vector<unsigned long> fastener_nodes = Nodes;
+	if (fastener_nodes.size() == 0) {
+		for (Map_it = FH_Map_Node_A.begin(); Map_it != FH_Map_Node_A.end(); Map_it++) {
+			fastener_nodes.push_back(Map_it->first);
+		}
+		for (Map_it = FH_Map_Node_B.begin(); Map_it != FH_Map_Node_B.end(); Map_it++) {
+			fastener_nodes.push_back(Map_it->first);
+		}
+	}
+	// CBUSH results are read for the fasteners at each node
+	BDF_Region neighbourhood;
+	for (int i = 0; i < fastener_nodes.size(); i++) {
+		neighbourhood.add_node(fastener_nodes[i]);
+		Map_it = FH_Map_Node_A.find(fastener_nodes[i]);
+		if (Map_it != FH_Map_Node_A.end()) {
+			for (int j = 0; j < Map_it->second.size(); j++) {
+				filter.add_CBUSH((*Map_it->second[j])[0]);
+			}
+		}
+		Map_it = FH_Map_Node_B.find(fastener_nodes[i]);
+		if (Map_it != FH_Map_Node_B.end()) {
+			for (int j = 0; j < Map_it->second.size(); j++) {
+				filter.add_CBUSH((*Map_it->second[j])[0]);
+			}
+		}
+	}
+	// CQUAD rings around the fastener nodes, the FH elements of each fastener are inside its rings
+	if (Rings < 1) {
+		Rings = 1;
+	}
+	neighbourhood.set_rings(Rings);
+	std::vector<unsigned long> topology;
+	for (CQUAD_it = CQUAD_Map.begin(); CQUAD_it != CQUAD_Map.end(); CQUAD_it++) {
+		for (int i = 0; i < 6; i++) {
+			topology.push_back((*CQUAD_it->second)[i]);
+		}
+	}
+	neighbourhood.add_topology(topology);
+	neighbourhood.select(GRID_Map, RBE2_Map, RBE3_Map, COORD_Map);
+	for (CQUAD_it = CQUAD_Map.begin(); CQUAD_it != CQUAD_Map.end(); CQUAD_it++) {
+		if (neighbourhood.has_CQUAD(CQUAD_it->first)) {
+			filter.add_CQUAD(CQUAD_it->first);
+		}
+	}
+}
+
 void FH_MODEL::calculate_FH_elements(std::vector<unsigned long> &NODE_List, std::vector<unsigned int> &Axis_List_1, 
 				std::vector<unsigned int> &Axis_List_2, std::vector<int> &Iterations, bool &Composite, 
 				std::vector<bool> &Mat_Orientation, std::vector<bool> &AS_IS, std::vector<unsigned long> &Axis_Check)
+{
+	clear_FH_fasteners();
+	prepare_FH_elements(NODE_List, Axis_List_1, Axis_List_2, Iterations, Composite, Mat_Orientation, AS_IS, Axis_Check);
+	for (int i = 0; i < FH_Fasteners.size(); i++) {
+		FH_Fasteners[i].bush->generate_FH_Result(CQUAD_Map, COORD_Map, GRID_Map, LOAD_CASE_Map, CBUSH_Map, FH_Fasteners[i].other_bush, 
+						FH_Fasteners[i].side_no, FH_Fasteners[i].mat_flag, FH_Fasteners[i].as_is, FH_Fasteners[i].axis);
+	}
+	clear_FH_fasteners();
+}
+
+void FH_MODEL::prepare_FH_elements(std::vector<unsigned long> &NODE_List, std::vector<unsigned int> &Axis_List_1, 
+				std::vector<unsigned int> &Axis_List_2, std::vector<int> &Iterations, bool &Composite, 
+				std::vector<bool> &Mat_Orientation, std::vector<bool> &AS_IS, std::vector<unsigned long> &Axis_Check)
 {
 	std::map<unsigned long, std::vector<CBUSH*> >::iterator Map_it;
 	// Check if a selection of CBUSH elements are provided, if not then all are requested
@@ -69,24 +140,10 @@ void FH_MODEL::calculate_FH_elements(std::vector<unsigned long> &NODE_List, std:
 		axis_array[0] = Axis_List_1[0];
 		axis_array[1] = Axis_List_2[0];
 		for (Map_it = FH_Map_Node_A.begin(); Map_it != FH_Map_Node_A.end(); Map_it++) {
-			Map_it->second[0]->parse_FH(GRID_Map, CQUAD_Map, RBE2_Map, RBE3_Map, COORD_Map, Iterations[0], 0, Axis_List_1[0]);
-			if (Map_it->second.size() > 1) {
-				Map_it->second[0]->generate_FH_Result(CQUAD_Map, COORD_Map, GRID_Map, LOAD_CASE_Map, CBUSH_Map, Map_it->second[1], 0, 
-								Mat_Orientation[0], AS_IS[0], axis_array);
-			} else {
-				Map_it->second[0]->generate_FH_Result(CQUAD_Map, COORD_Map, GRID_Map, LOAD_CASE_Map, CBUSH_Map, NULL, 0, 
-								Mat_Orientation[0], AS_IS[0], axis_array);
-			}				
+			add_FH_fastener(Map_it->second, 0, Iterations[0], Axis_List_1[0], Mat_Orientation[0], AS_IS[0], axis_array);
 		}
 		for (Map_it = FH_Map_Node_B.begin(); Map_it != FH_Map_Node_B.end(); Map_it++) {
-			Map_it->second[0]->parse_FH(GRID_Map, CQUAD_Map, RBE2_Map, RBE3_Map, COORD_Map, Iterations[0], 1, Axis_List_1[0]);
-			if (Map_it->second.size() > 1) {
-				Map_it->second[0]->generate_FH_Result(CQUAD_Map, COORD_Map, GRID_Map, LOAD_CASE_Map, CBUSH_Map, Map_it->second[1], 1, 
-								Mat_Orientation[0], AS_IS[0], axis_array);
-			} else {
-				Map_it->second[0]->generate_FH_Result(CQUAD_Map, COORD_Map, GRID_Map, LOAD_CASE_Map, CBUSH_Map, NULL, 1, 
-								Mat_Orientation[0], AS_IS[0], axis_array);
-			}
+			add_FH_fastener(Map_it->second, 1, Iterations[0], Axis_List_1[0], Mat_Orientation[0], AS_IS[0], axis_array);
 		}
 	} else {
 		//	Individual nodes selected
@@ -105,14 +162,7 @@ void FH_MODEL::calculate_FH_elements(std::vector<unsigned long> &NODE_List, std:
 					axis_array[0] = Axis_List_2[i];	
 				}
 
-				Map_it->second[0]->parse_FH(GRID_Map, CQUAD_Map, RBE2_Map, RBE3_Map, COORD_Map, Iterations[i], 0, Axis_List_1[i]);
-				if (Map_it->second.size() > 1) {
-					Map_it->second[0]->generate_FH_Result(CQUAD_Map, COORD_Map, GRID_Map, LOAD_CASE_Map, CBUSH_Map, Map_it->second[1], 0, 
-									Mat_Orientation[i], AS_IS[i], axis_array);
-				} else {
-					Map_it->second[0]->generate_FH_Result(CQUAD_Map, COORD_Map, GRID_Map, LOAD_CASE_Map, CBUSH_Map, NULL, 0, 
-									Mat_Orientation[i], AS_IS[i], axis_array);
-				}				
+				add_FH_fastener(Map_it->second, 0, Iterations[i], Axis_List_1[i], Mat_Orientation[i], AS_IS[i], axis_array);
 			}
 			Map_it = FH_Map_Node_B.find(NODE_List[i]);
 			if (Map_it != FH_Map_Node_B.end()) {
@@ -125,19 +175,80 @@ void FH_MODEL::calculate_FH_elements(std::vector<unsigned long> &NODE_List, std:
 					axis_array[1] = Axis_List_1[i];
 					axis_array[0] = Axis_List_2[i];	
 				}
-				Map_it->second[0]->parse_FH(GRID_Map, CQUAD_Map, RBE2_Map, RBE3_Map, COORD_Map, Iterations[i], 1, Axis_List_1[i]);
-				if (Map_it->second.size() > 1) {
-					Map_it->second[0]->generate_FH_Result(CQUAD_Map, COORD_Map, GRID_Map, LOAD_CASE_Map, CBUSH_Map, Map_it->second[1], 1, 
-									Mat_Orientation[i], AS_IS[i], axis_array);
-				} else {
-					Map_it->second[0]->generate_FH_Result(CQUAD_Map, COORD_Map, GRID_Map, LOAD_CASE_Map, CBUSH_Map, NULL, 1, 
-									Mat_Orientation[i], AS_IS[i], axis_array);
-				}				
+				add_FH_fastener(Map_it->second, 1, Iterations[i], Axis_List_1[i], Mat_Orientation[i], AS_IS[i], axis_array);
 			}
 		}	
 	}
 }
 
+void FH_MODEL::calculate_FH_subcase(unsigned long SubcaseID)
+{
+	// Results are generated for a load case map holding only the subcase
+	LOAD_CASE_it = LOAD_CASE_Map.find(SubcaseID);
+	if (LOAD_CASE_it == LOAD_CASE_Map.end()) {
+		return;
+	}
+	std::map<unsigned long, LOAD_CASE*> subcase_map;
+	subcase_map.insert(*LOAD_CASE_it);
+	for (int i = 0; i < FH_Fasteners.size(); i++) {
+		FH_Fasteners[i].bush->generate_FH_Result(CQUAD_Map, COORD_Map, GRID_Map, subcase_map, CBUSH_Map, FH_Fasteners[i].other_bush, 
+						FH_Fasteners[i].side_no, FH_Fasteners[i].mat_flag, FH_Fasteners[i].as_is, FH_Fasteners[i].axis);
+	}
+}
+
+bool FH_MODEL::stream_FH_results(std::vector<std::string> &fileNames)
+{
+	Punch_Stream stream;
+	if (!openPunchStream(fileNames, stream)) {
+		clear_FH_fasteners();
+		return false;
+	}
+	for (int i = 0; i < stream.subcases.size(); i++) {
+		if (!parsePunchSubcase(stream, stream.subcases[i])) {
+			// The results are incomplete, the subcase is dropped rather than written with missing results
+			std::cout << "Subcase " << stream.subcases[i] << " skipped, its results could not be read" << std::endl;
+			LOAD_CASE_it = LOAD_CASE_Map.find(stream.subcases[i]);
+			if (LOAD_CASE_it != LOAD_CASE_Map.end()) {
+				delete LOAD_CASE_it->second;
+				LOAD_CASE_Map.erase(LOAD_CASE_it);
+			}
+			continue;
+		}
+		calculate_FH_subcase(stream.subcases[i]);
+	}
+	clearResults();
+	clear_FH_fasteners();
+	return true;
+}
+
+void FH_MODEL::add_FH_fastener(std::vector<CBUSH*> &bushes, int side_no, int iterations, unsigned int axis_type, bool mat_flag, bool as_is, unsigned int axis_array[2])
+{
+	// A fastener side already prepared keeps its FH elements and options
+	if (!FH_Prepared.insert(std::pair<CBUSH*, int> (bushes[0], side_no)).second) {
+		return;
+	}
+	bushes[0]->parse_FH(GRID_Map, CQUAD_Map, RBE2_Map, RBE3_Map, COORD_Map, iterations, side_no, axis_type);
+	FH_Fastener fastener;
+	fastener.bush = bushes[0];
+	if (bushes.size() > 1) {
+		fastener.other_bush = bushes[1];
+	} else {
+		fastener.other_bush = NULL;
+	}
+	fastener.side_no = side_no;
+	fastener.mat_flag = mat_flag;
+	fastener.as_is = as_is;
+	fastener.axis[0] = axis_array[0];
+	fastener.axis[1] = axis_array[1];
+	FH_Fasteners.push_back(fastener);
+}
+
+void FH_MODEL::clear_FH_fasteners()
+{
+	FH_Fasteners.clear();
+	FH_Prepared.clear();
+}
+
 void FH_MODEL::generate_FH_output(std::string output_file, std::vector<unsigned long> &NODE_List, 
 		std::vector<unsigned long> &SUBCASE_List, std::vector<int> &Iterations, bool Composite)
 {
@@ -65,13 +65,24 @@ int main(int argc, char* argv[])
 	std::vector<std::string> punch_files, group_files;
 	std::vector<unsigned long> subcases;
 	std::string input_line;
+	//	Card types loaded from the model, PBUSH is not used by the FH analysis
+	BDF_Profile profile;
+	profile.clear();
+	profile.add("FH");
+	bool profile_set = false;
+	//	Region of interest around the GROUP fasteners, rings of 0 take the rings from the group file iterations
+	std::string region_param;
+	//	Binary snapshot of the parsed model, reused while the model files are unchanged
+	std::string snapshot_file;
+	//	Punch results are read and reduced to FH results one subcase at a time
+	bool stream_results = false;
 	if (control_file.is_open()) {		
-		bool input_flag = false, punch_flag = false, group_flag = false, all_flag = false, subcase_flag = false;
+		bool input_flag = false, punch_flag = false, group_flag = false, all_flag = false, subcase_flag = false, profile_flag = false, region_flag = false, snapshot_flag = false;
 		while (!control_file.eof()) {
 			std::getline(control_file, input_line);
 			input_line = trim(input_line);
 			if (input_flag) {
-				if (input_line.compare("PUNCH") != 0 && input_line.compare("GROUP") != 0 && input_line.compare("ALL") != 0 && input_line.compare("") != 0 && input_line.compare("SUBCASES") != 0) {
+				if (input_line.compare("PUNCH") != 0 && input_line.compare("GROUP") != 0 && input_line.compare("ALL") != 0 && input_line.compare("PROFILE") != 0 && input_line.compare("REGION") != 0 && input_line.compare("SNAPSHOT") != 0 && input_line.compare("STREAM") != 0 && input_line.compare("") != 0 && input_line.compare("SUBCASES") != 0) {
 					input_file = input_line;
 					input_flag = false;
 					continue;
@@ -80,7 +91,7 @@ int main(int argc, char* argv[])
 				}
 			}
 			if (punch_flag) {
-				if (input_line.compare("INPUT") != 0 && input_line.compare("GROUP") != 0 && input_line.compare("ALL") != 0 && input_line.compare("") != 0 && input_line.compare("SUBCASES") != 0) {
+				if (input_line.compare("INPUT") != 0 && input_line.compare("GROUP") != 0 && input_line.compare("ALL") != 0 && input_line.compare("PROFILE") != 0 && input_line.compare("REGION") != 0 && input_line.compare("SNAPSHOT") != 0 && input_line.compare("STREAM") != 0 && input_line.compare("") != 0 && input_line.compare("SUBCASES") != 0) {
 					punch_files.push_back(input_line);
 					continue;
 				} else {
@@ -88,7 +99,7 @@ int main(int argc, char* argv[])
 				}			
 			}
 			if (group_flag) {
-				if (input_line.compare("INPUT") != 0 && input_line.compare("PUNCH") != 0 && input_line.compare("ALL") != 0 && input_line.compare("") != 0 && input_line.compare("SUBCASES") != 0) {
+				if (input_line.compare("INPUT") != 0 && input_line.compare("PUNCH") != 0 && input_line.compare("ALL") != 0 && input_line.compare("PROFILE") != 0 && input_line.compare("REGION") != 0 && input_line.compare("SNAPSHOT") != 0 && input_line.compare("STREAM") != 0 && input_line.compare("") != 0 && input_line.compare("SUBCASES") != 0) {
 					group_files.push_back(input_line);
 					continue;
 				} else {
@@ -96,7 +107,7 @@ int main(int argc, char* argv[])
 				}			
 			}
 			if (all_flag) {
-				if (input_line.compare("PUNCH") != 0 && input_line.compare("GROUP") != 0 && input_line.compare("INPUT") != 0 && input_line.compare("") != 0 && input_line.compare("SUBCASES") != 0) {
+				if (input_line.compare("PUNCH") != 0 && input_line.compare("GROUP") != 0 && input_line.compare("INPUT") != 0 && input_line.compare("PROFILE") != 0 && input_line.compare("REGION") != 0 && input_line.compare("SNAPSHOT") != 0 && input_line.compare("STREAM") != 0 && input_line.compare("") != 0 && input_line.compare("SUBCASES") != 0) {
 					all_param = input_line;
 					all_flag = false;
 					continue;
@@ -105,7 +116,7 @@ int main(int argc, char* argv[])
 				}
 			}
 			if (subcase_flag) {
-				if (input_line.compare("PUNCH") != 0 && input_line.compare("GROUP") != 0 && input_line.compare("INPUT") != 0 && input_line.compare("") != 0 && input_line.compare("ALL") != 0) {
+				if (input_line.compare("PUNCH") != 0 && input_line.compare("GROUP") != 0 && input_line.compare("INPUT") != 0 && input_line.compare("PROFILE") != 0 && input_line.compare("REGION") != 0 && input_line.compare("SNAPSHOT") != 0 && input_line.compare("STREAM") != 0 && input_line.compare("") != 0 && input_line.compare("ALL") != 0) {
 					std::vector<std::string> data_vector = parse_comma(input_line);
 					for (int i = 0; i < data_vector.size(); i++) {
 						subcases.push_back(atol(trim(data_vector[i]).c_str()));
@@ -115,6 +126,42 @@ int main(int argc, char* argv[])
 					subcase_flag = false;
 				}
 			}
+			if (profile_flag) {
+				if (input_line.compare("INPUT") != 0 && input_line.compare("PUNCH") != 0 && input_line.compare("GROUP") != 0 && input_line.compare("ALL") != 0 && input_line.compare("STREAM") != 0 && input_line.compare("") != 0 && input_line.compare("SUBCASES") != 0 && input_line.compare("REGION") != 0 && input_line.compare("SNAPSHOT") != 0) {
+					//	Profile names and card names, the first entry replaces the default profile
+					if (!profile_set) {
+						profile.clear();
+						profile_set = true;
+					}
+					std::vector<std::string> data_vector = parse_comma(input_line);
+					for (int i = 0; i < data_vector.size(); i++) {
+						if (!profile.add(trim(data_vector[i]))) {
+							std::cout << "Unknown profile or card name: " << data_vector[i] << std::endl;
+						}
+					}
+					continue;
+				} else {
+					profile_flag = false;
+				}
+			}
+			if (region_flag) {
+				if (input_line.compare("INPUT") != 0 && input_line.compare("PUNCH") != 0 && input_line.compare("GROUP") != 0 && input_line.compare("ALL") != 0 && input_line.compare("PROFILE") != 0 && input_line.compare("STREAM") != 0 && input_line.compare("") != 0 && input_line.compare("SUBCASES") != 0 && input_line.compare("SNAPSHOT") != 0) {
+					region_param = input_line;
+					region_flag = false;
+					continue;
+				} else {
+					region_flag = false;
+				}
+			}
+			if (snapshot_flag) {
+				if (input_line.compare("INPUT") != 0 && input_line.compare("PUNCH") != 0 && input_line.compare("GROUP") != 0 && input_line.compare("ALL") != 0 && input_line.compare("PROFILE") != 0 && input_line.compare("REGION") != 0 && input_line.compare("STREAM") != 0 && input_line.compare("") != 0 && input_line.compare("SUBCASES") != 0) {
+					snapshot_file = input_line;
+					snapshot_flag = false;
+					continue;
+				} else {
+					snapshot_flag = false;
+				}
+			}
 			if (input_line.compare("INPUT") == 0) {
 				input_flag = true;
 				continue;
@@ -135,6 +182,22 @@ int main(int argc, char* argv[])
 				subcase_flag = true;
 				continue;
 			}
+			if (input_line.compare("PROFILE") == 0) {
+				profile_flag = true;
+				continue;
+			}
+			if (input_line.compare("REGION") == 0) {
+				region_flag = true;
+				continue;
+			}
+			if (input_line.compare("SNAPSHOT") == 0) {
+				snapshot_flag = true;
+				continue;
+			}
+			if (input_line.compare("STREAM") == 0) {
+				stream_results = true;
+				continue;
+			}
 		}
 	} else {
 		std::cout << "Unable to open control file: " << argv[1] << std::endl;
@@ -149,14 +212,85 @@ int main(int argc, char* argv[])
 		std::cout << "No punch files entered" << std::endl;
 		return 0;
 	}
-	//	Load model	
-	FH_MODEL myModel(input_file);
-	//	Read Punch Files
-	for (int i = 0; i < punch_files.size(); i++) {
-		myModel.parsePunchFile(punch_files[i]);
+	if (profile.is_empty()) {
+		std::cout << "No card types defined in control file profile" << std::endl;
+		return 0;
 	}
+	//	Fastener nodes of the group files and the CQUAD rings around them, read before the model is loaded
+	std::vector<unsigned long> group_nodes;
+	int group_rings = 0;
+	for (int i = 0; i < group_files.size(); i++) {
+		std::fstream group_file;
+		group_file.open(group_files[i].c_str(), std::ios_base::in);
+		while (group_file.is_open() && !group_file.eof()) {
+			std::getline(group_file, input_line);
+			std::vector<std::string> data_vector = parse_comma(input_line);
+			if (data_vector.size() > 6) {
+				group_nodes.push_back(atol(trim(data_vector[0]).c_str()));
+				if (atoi(trim(data_vector[1]).c_str()) / 2 > group_rings) {
+					group_rings = atoi(trim(data_vector[1]).c_str()) / 2;
+				}
+			}
+		}
+		group_file.close();
+	}
+	//	Region of interest around the group fastener nodes
+	BDF_Region region;
+	if (region_param.compare("") != 0) {
+		if (group_files.size() == 0) {
+			std::cout << "No group files entered, loading whole model" << std::endl;
+		} else {
+			int rings = group_rings;
+			for (int i = 0; i < group_nodes.size(); i++) {
+				region.add_node(group_nodes[i]);
+			}
+			std::vector<std::string> data_vector = parse_comma(region_param);
+			if (trim(data_vector[0]).compare("DISTANCE") == 0 && data_vector.size() > 1) {
+				region.set_distance(atof(trim(data_vector[1]).c_str()));
+			} else if (trim(data_vector[0]).compare("RINGS") == 0) {
+				if (data_vector.size() > 1) {
+					rings = atoi(trim(data_vector[1]).c_str());
+				}
+				if (rings < 1) {
+					rings = 1;
+				}
+				region.set_rings(rings);
+			} else {
+				std::cout << "Unable to parse region in control file" << std::endl;
+				return 0;
+			}
+		}
+	}
+	if (!region.is_empty() && snapshot_file.compare("") != 0) {
+		std::cout << "Model snapshot not used with a region" << std::endl;
+	}
+	//	Load model	
+	FH_MODEL myModel;
+	myModel.setProfile(profile);
+	myModel.setRegion(region);
+	myModel.setSnapshot(snapshot_file);
+	myModel.parseModel(input_file);
 	//	Prepare FH grids
 	myModel.generate_FH_List();
+	//	Punch results are only kept for the selected subcases and the elements around the selected fasteners
+	Punch_Filter punch_filter;
+	for (int i = 0; i < subcases.size(); i++) {
+		punch_filter.add_subcase(subcases[i]);
+	}
+	int filter_rings = group_rings;
+	if (group_files.size() == 0) {
+		std::vector<std::string> all_vector = parse_comma(all_param);
+		if (all_vector.size() > 1) {
+			filter_rings = atoi(trim(all_vector[1]).c_str()) / 2;
+		}
+	}
+	myModel.select_FH_results(group_nodes, filter_rings, punch_filter);
+	std::cout << "Reading punch results for " << punch_filter.CQUAD_size() << " CQUAD and " << punch_filter.CBUSH_size() << " CBUSH entries" << std::endl;
+	myModel.setPunchFilter(punch_filter);
+	//	Read Punch Files, the files are read concurrently. Streamed results are read once the FH elements are prepared
+	if (!stream_results) {
+		myModel.parsePunchFiles(punch_files);
+	}
 	
 	std::vector<std::string> data_vector;
 	if (group_files.size() == 0) {
@@ -183,7 +317,14 @@ int main(int argc, char* argv[])
 			Axis_List_2.push_back(Axis_List_1[0]);
 			// Enter
 			std::cout << "Calculating FH Results" << std::endl;
-			myModel.calculate_FH_elements(NODE_List, Axis_List_1, Axis_List_2, Iterations, Composite, Mat_Orientation, AS_IS, Axis_Check);
+			if (stream_results) {
+				myModel.prepare_FH_elements(NODE_List, Axis_List_1, Axis_List_2, Iterations, Composite, Mat_Orientation, AS_IS, Axis_Check);
+				if (!myModel.stream_FH_results(punch_files)) {
+					return 0;
+				}
+			} else {
+				myModel.calculate_FH_elements(NODE_List, Axis_List_1, Axis_List_2, Iterations, Composite, Mat_Orientation, AS_IS, Axis_Check);
+			}
 			std::cout << "Writing FH Results to: FH_Data.res" << std::endl;
 			myModel.generate_FH_output("FH_Data.res", NODE_List, subcases, Iterations, Composite);
 		} else {
@@ -192,62 +333,76 @@ int main(int argc, char* argv[])
 		}
 
 	} else {
-		// Multiple fastener groups selected
-		for (int i = 0; i < group_files.size(); i++) {
-			//	Open control file
-			std::fstream group_file;
-			group_file.open(group_files[i].c_str(), std::ios_base::in);
-			if (group_file.is_open()) {
-				while (!group_file.eof()) {
-					std::getline(group_file, input_line);
-					data_vector = parse_comma(input_line);
-					if (data_vector.size() > 6) {
-						NODE_List.push_back(atol(trim(data_vector[0]).c_str()));
-						Iterations.push_back(atoi(trim(data_vector[1]).c_str()));
-						if (trim(data_vector[2]).compare("MAT") == 0) {
-							Mat_Orientation.push_back(true);
-						} else {
-							Mat_Orientation.push_back(false);
-						}
-						if (trim(data_vector[3]).compare("MAT") == 0) {
-							AS_IS.push_back(false);
-						} else {
-							AS_IS.push_back(true);
+		// Multiple fastener groups selected. Streamed results are read once the FH elements of every group are prepared in a first pass
+		int first_pass = stream_results ? 0 : 1;
+		for (int pass = first_pass; pass < 2; pass++) {
+			if (pass == 1 && stream_results) {
+				std::cout << "Calculating FH Results" << std::endl;
+				if (!myModel.stream_FH_results(punch_files)) {
+					return 0;
+				}
+			}
+			for (int i = 0; i < group_files.size(); i++) {
+				//	Open control file
+				std::fstream group_file;
+				group_file.open(group_files[i].c_str(), std::ios_base::in);
+				if (group_file.is_open()) {
+					while (!group_file.eof()) {
+						std::getline(group_file, input_line);
+						data_vector = parse_comma(input_line);
+						if (data_vector.size() > 6) {
+							NODE_List.push_back(atol(trim(data_vector[0]).c_str()));
+							Iterations.push_back(atoi(trim(data_vector[1]).c_str()));
+							if (trim(data_vector[2]).compare("MAT") == 0) {
+								Mat_Orientation.push_back(true);
+							} else {
+								Mat_Orientation.push_back(false);
+							}
+							if (trim(data_vector[3]).compare("MAT") == 0) {
+								AS_IS.push_back(false);
+							} else {
+								AS_IS.push_back(true);
+							}
+							if (trim(data_vector[4]).compare("SINGLE") == 0) {
+								Axis_List_1.push_back(atoi(trim(data_vector[5]).c_str()));
+								Axis_List_2.push_back(Axis_List_1[0]);
+								Axis_Check.push_back(0);
+							} else {
+								// Dual CBUSH configuration
+								Axis_Check.push_back(atol(trim(data_vector[4]).c_str()));
+								Axis_List_1.push_back(atoi(trim(data_vector[5]).c_str()));
+								Axis_List_2.push_back(atoi(trim(data_vector[6]).c_str()));						
+							}				
 						}
-						if (trim(data_vector[4]).compare("SINGLE") == 0) {
-							Axis_List_1.push_back(atoi(trim(data_vector[5]).c_str()));
-							Axis_List_2.push_back(Axis_List_1[0]);
-							Axis_Check.push_back(0);
-						} else {
-							// Dual CBUSH configuration
-							Axis_Check.push_back(atol(trim(data_vector[4]).c_str()));
-							Axis_List_1.push_back(atoi(trim(data_vector[5]).c_str()));
-							Axis_List_2.push_back(atoi(trim(data_vector[6]).c_str()));						
-						}				
 					}
+				} else if (pass == first_pass) {
+					std::cout << "Unable to open group file: " << group_files[i] << std::endl;
 				}
-			} else {
-				std::cout << "Unable to open group file: " << group_files[i] << std::endl;
-			}
-			group_file.close();
+				group_file.close();
 			
-			if (NODE_List.size() > 0) {
-				std::cout << "Calculating FH Results for: " << group_files[i] << std::endl;
-				myModel.calculate_FH_elements(NODE_List, Axis_List_1, Axis_List_2, Iterations, Composite, Mat_Orientation, AS_IS, Axis_Check);
-				std::string output_file_name = remove_file_extension(group_files[i]);
-				output_file_name.append(".res");
-				std::cout << "Writing FH Results to: " << output_file_name << std::endl;
-				myModel.generate_FH_output(output_file_name, NODE_List, subcases, Iterations, Composite);
-			} else {
-				std::cout << "Unable to parse group file: " << group_files[i] << std::endl;
+				if (NODE_List.size() > 0 && pass == 0) {
+					std::cout << "Preparing FH elements for: " << group_files[i] << std::endl;
+					myModel.prepare_FH_elements(NODE_List, Axis_List_1, Axis_List_2, Iterations, Composite, Mat_Orientation, AS_IS, Axis_Check);
+				} else if (NODE_List.size() > 0) {
+					if (!stream_results) {
+						std::cout << "Calculating FH Results for: " << group_files[i] << std::endl;
+						myModel.calculate_FH_elements(NODE_List, Axis_List_1, Axis_List_2, Iterations, Composite, Mat_Orientation, AS_IS, Axis_Check);
+					}
+					std::string output_file_name = remove_file_extension(group_files[i]);
+					output_file_name.append(".res");
+					std::cout << "Writing FH Results to: " << output_file_name << std::endl;
+					myModel.generate_FH_output(output_file_name, NODE_List, subcases, Iterations, Composite);
+				} else if (pass == first_pass) {
+					std::cout << "Unable to parse group file: " << group_files[i] << std::endl;
+				}
+				NODE_List.clear();
+				Iterations.clear();
+				Mat_Orientation.clear();
+				AS_IS.clear();
+				Axis_List_1.clear();
+				Axis_List_2.clear();
+				Axis_Check.clear();
 			}
-			NODE_List.clear();
-			Iterations.clear();
-			Mat_Orientation.clear();
-			AS_IS.clear();
-			Axis_List_1.clear();
-			Axis_List_2.clear();
-			Axis_Check.clear();
 		}
 
 	}
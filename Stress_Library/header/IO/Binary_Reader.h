@@ -0,0 +1,57 @@
+/**
+ *
+ * @file		Binary_Reader.h
+ * @author		Matt Guimarey
+ * @date		17/10/2026
+ * @version		1.0
+ *
+ * This class defines a reader of binary data files written by Binary_Writer
+ *
+ */
+
+#ifndef BINARY_READER_H
+#define BINARY_READER_H
+
+#include "Mapped_File.h"
+
+#include <string>
+#include <vector>
+#include <cstddef>
+
+class Binary_Reader
+{
+	public:
+		Binary_Reader();
+		~Binary_Reader();
+
+		//	Map a file into memory for reading, returns false if the file could not be opened
+		bool open(std::string fileName);
+
+		/*	Read values in the order they were written. Reading past the end of the file returns zero
+			values and clears the good flag */
+		unsigned long long read_ulong();
+		double read_double();
+		bool read_bool();
+		std::string read_string();
+		void read_ulongs(std::vector<unsigned long> &Values);
+		void read_doubles(std::vector<double> &Values);
+
+		//	Returns false if the file did not open or a read passed the end of the file
+		bool good();
+
+		//	Returns true if every byte of the file has been read
+		bool at_end();
+
+		//	Number of bytes of the file not yet read, used to bound counts read from the file before allocating
+		std::size_t remaining();
+
+	private:
+		Mapped_File pFile;			///< Mapped file being read
+		const char* pCursor;		///< Position of the next read
+		bool pGood;					///< Flags whether all reads so far were inside the file
+
+		//	Returns the position of the next Size bytes and advances, NULL if past the end of the file
+		const char* take(std::size_t Size);
+};
+
+#endif // BINARY_READER_H
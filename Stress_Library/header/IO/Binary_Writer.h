@@ -0,0 +1,50 @@
+/**
+ *
+ * @file		Binary_Writer.h
+ * @author		Matt Guimarey
+ * @date		17/10/2026
+ * @version		1.0
+ *
+ * This class defines a buffered writer of binary data files
+ *
+ */
+
+#ifndef BINARY_WRITER_H
+#define BINARY_WRITER_H
+
+#include <string>
+#include <vector>
+#include <cstddef>
+
+class Binary_Writer
+{
+	public:
+		Binary_Writer();
+		~Binary_Writer();
+
+		/*	Append values to the buffer. Integers are written as 8 bytes and all values in native byte
+			order, so a file is read back with Binary_Reader on the same platform */
+		void write_ulong(unsigned long long Value);
+		void write_double(double Value);
+		void write_bool(bool Value);
+		void write_string(const std::string &Value);
+
+		//	Append a vector as its size followed by its values
+		void write_ulongs(const std::vector<unsigned long> &Values);
+		void write_doubles(const std::vector<double> &Values);
+
+		/*	Write the buffer to a file, the file is written under a temporary name and then renamed so
+			an interrupted write never leaves a partial file. Returns false if the file could not be written */
+		bool save(std::string fileName);
+
+		//	Returns true if the same bytes have been written to both writers
+		bool same(const Binary_Writer &other) const;
+
+	private:
+		std::vector<char> pBuffer;		///< Buffer holding the bytes written, may be larger than the data
+		std::size_t pSize;				///< Number of bytes written
+
+		void append(const void* Data, std::size_t Size);
+};
+
+#endif // BINARY_WRITER_H
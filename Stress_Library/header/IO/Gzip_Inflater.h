@@ -0,0 +1,63 @@
+/**
+ *
+ * @file		Gzip_Inflater.h
+ * @author		Matt Guimarey
+ * @date		17/10/2026
+ * @version		1.0
+ *
+ * This class defines a decompressor of gzip (RFC 1952) data held in memory
+ *
+ */
+
+#ifndef GZIP_INFLATER_H
+#define GZIP_INFLATER_H
+
+#include <vector>
+#include <cstddef>
+
+class Huffman_Table;
+
+class Gzip_Inflater
+{
+	public:
+		//	Constructor setting the compressed data, no bytes are copied
+		Gzip_Inflater(const char* Begin, const char* End);
+
+		~Gzip_Inflater();
+
+		//	Returns true if the data starts with the gzip magic number
+		static bool is_gzip(const char* begin, const char* end);
+
+		/*	Decompresses every gzip member of the data into output, members written one after another are
+			joined as gzip does. Returns false if the data is not gzip, is corrupt or is truncated */
+		bool inflate(std::vector<char> &output);
+
+	private:
+		const unsigned char* pPosition;		///< Next byte of compressed data to load into the bit buffer
+		const unsigned char* pEnd;			///< One past the last byte of compressed data
+		unsigned long long pBits;			///< Bit buffer, the next bit of the stream is bit 0
+		int pBitCount;						///< Number of bits held in the bit buffer
+		std::vector<char>* pOutput;			///< Output being written, sized ahead of pSize
+		std::size_t pSize;					///< Number of bytes written to the output
+
+		//	Decompresses one gzip member, header, deflate blocks and trailer
+		bool read_member();
+
+		//	Decompress the three deflate block types, stored, fixed Huffman and dynamic Huffman
+		bool copy_stored();
+		bool inflate_block(const Huffman_Table &lengths, const Huffman_Table &distances);
+		bool inflate_dynamic();
+
+		//	Bit buffer access, get_bits returns false if the data ends first
+		void refill();
+		bool get_bits(int count, unsigned int &value);
+		int decode(const Huffman_Table &table);
+
+		//	Returns the whole bytes left in the bit buffer to the input, at a byte boundary
+		void align_input();
+
+		//	Grows the output so count more bytes can be written
+		void reserve(std::size_t count);
+};
+
+#endif // GZIP_INFLATER_H
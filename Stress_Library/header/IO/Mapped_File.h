@@ -0,0 +1,69 @@
+/**
+ *
+ * @file		Mapped_File.h
+ * @author		Matt Guimarey
+ * @date		17/10/2026
+ * @version		1.0
+ *
+ * This class defines a read-only memory mapped file, gzip files are decompressed into memory
+ *
+ */
+
+#ifndef MAPPED_FILE_H
+#define MAPPED_FILE_H
+
+#include <string>
+#include <vector>
+#include <cstddef>
+
+class Mapped_File
+{
+	public:
+		Mapped_File();
+
+		//	Constructor mapping a file into memory
+		Mapped_File(std::string fileName);
+
+		~Mapped_File();
+
+		/*	Map a file into memory for reading, returns false if the file could not be opened or mapped. A file
+			named .gz holding gzip data is decompressed and its contents read in place of the file, a .gz file
+			that does not decompress and a zstd file fail to open. The file is mapped whole, a 32 bit build
+			refuses a file larger than its address space */
+		bool open(std::string fileName);
+
+		//	Unmap the file and release all handles
+		void close();
+
+		//	Returns true if a file is mapped (an empty file is considered open with size 0)
+		bool is_open();
+
+		//	Pointer to the first byte of the mapped file, NULL for an empty or closed file
+		const char* begin();
+
+		//	Pointer one past the last byte of the mapped file
+		const char* end();
+
+		//	Size of the mapped file in bytes
+		std::size_t size();
+
+	private:
+		const char* pData;		///< Pointer to the mapped view
+		std::size_t pSize;		///< Size of the mapped view in bytes
+		bool pOpen;				///< Flags whether a file is currently mapped
+		std::vector<char> pInflated;	///< Decompressed contents of a gzip file, pData points into it
+#ifdef _WIN32
+		void* pFileHandle;		///< Win32 file handle
+		void* pMapHandle;		///< Win32 file mapping handle
+#else
+		int pFileHandle;		///< POSIX file descriptor
+#endif
+
+		//	Decompresses a mapped gzip file into pInflated, returns false if the file was closed
+		bool decompress(std::string fileName);
+
+		Mapped_File(const Mapped_File&);
+		Mapped_File& operator=(const Mapped_File&);
+};
+
+#endif // MAPPED_FILE_H
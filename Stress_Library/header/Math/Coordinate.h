@@ -12,6 +12,9 @@
 #ifndef COORDINATE_H
 #define COORDINATE_H
 
+#include "IO/Binary_Writer.h"
+#include "IO/Binary_Reader.h"
+
 class Coordinate
 {
 	public:
@@ -48,6 +51,10 @@ class Coordinate
 		Coordinate operator/(double num);
 		Coordinate operator*(double num);
 
+		//	Write and read the class data in a binary model snapshot
+		void writeSnapshot(Binary_Writer &writer);
+		void readSnapshot(Binary_Reader &reader);
+
 	private:
 		double pCoords[3];		///< double array holding the coordinate points
 		unsigned long pRef;		///< unsigned long holding the ID of a reference coordinate frame
@@ -14,6 +14,8 @@
 
 #include "Math/Euclidean_Vector.h"
 #include "Math/Coordinate.h"
+#include "IO/Binary_Writer.h"
+#include "IO/Binary_Reader.h"
 
 class Transformation
 {
@@ -49,6 +51,11 @@ class Transformation
 
 		/* 	Get a component from the transformation matrix -> a_i,j */
 		double get_component(unsigned int i, unsigned int j);
+
+		//	Write and read the class data in a binary model snapshot
+		void writeSnapshot(Binary_Writer &writer);
+		void readSnapshot(Binary_Reader &reader);
+
 	private:
 		double pMatrix[3][3];
 };
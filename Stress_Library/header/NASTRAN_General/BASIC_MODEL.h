@@ -23,9 +23,30 @@
 #include "RBE2.h"
 #include "RBE3.h"
 #include "LOAD_CASE.h"
+#include "BDF_Line.h"
+#include "BDF_Buffer.h"
+#include "Card_Arena.h"
+#include "Model_View.h"
+#include "BDF_Profile.h"
+#include "BDF_Region.h"
+#include "BDF_Source.h"
+#include "Punch_Buffer.h"
+#include "Punch_Filter.h"
+#include "Punch_Index.h"
+#include "Punch_Stream.h"
+#include "Result_Store.h"
+#include "Ply_Store.h"
+#include "ID_Index.h"
+#include "OP2_Reader.h"
+#include "IO/Mapped_File.h"
+#include "IO/Binary_Writer.h"
+#include "IO/Binary_Reader.h"
+#include "Parallel/Thread_Pool.h"
 #include <string>
 #include <vector>
 #include <map>
+#include <memory>
+#include <functional>
 
 class BASIC_MODEL
 {
@@ -34,6 +55,13 @@ class BASIC_MODEL
 
 		//	Constructor parsing model data, Master .bdf file only
 		BASIC_MODEL(std::string fileName);
+
+		//	Constructor parsing model data, only card types in the profile are loaded
+		BASIC_MODEL(std::string fileName, BDF_Profile profile);
+
+		/*	Constructor parsing model data in two passes, the second pass only loads the CQUADs and shell
+			properties inside the region */
+		BASIC_MODEL(std::string fileName, BDF_Profile profile, BDF_Region region);
 		~BASIC_MODEL();
 
 		//	Return a pointer to a NASTRAN element/grid class, NULL if not found
@@ -49,7 +77,38 @@ class BASIC_MODEL
 		RBE3* getRBE3(unsigned long ElementID);
 		LOAD_CASE* getLOAD_CASE(unsigned long SubcaseID);
 
-		//	Return a map to NASTRAN elements/grids stored on heap
+		/*	Return the dense index of a GRID/CQUAD/CBUSH in the frozen model, indices run in ID order from 0 to
+			the count - 1. False if not found or the model is not frozen */
+		bool getGRIDIndex(unsigned long GridID, unsigned long &Index);
+		bool getCQUADIndex(unsigned long ElementID, unsigned long &Index);
+		bool getCBUSHIndex(unsigned long ElementID, unsigned long &Index);
+
+		//	Return a pointer to the GRID/CQUAD/CBUSH at a dense index, NULL if out of range or the model is not frozen
+		GRID* getGRIDAt(unsigned long Index);
+		CQUAD* getCQUADAt(unsigned long Index);
+		CBUSH* getCBUSHAt(unsigned long Index);
+
+		//	Return the number of GRIDs/CQUADs/CBUSHes addressed by dense index, 0 if the model is not frozen
+		unsigned long getGRIDCount();
+		unsigned long getCQUADCount();
+		unsigned long getCBUSHCount();
+
+		/*	Return a read-only view of the NASTRAN elements/grids held by the model, with lookup by ID, iteration
+			in ID order and ID ranges. Cards are given as const pointers and none are copied, a view reads the
+			model each time it is used and is valid for the life of the model */
+		Model_View<CQUAD> getCQUADView() const;
+		Model_View<GRID> getGRIDView() const;
+		Model_View<CBUSH> getCBUSHView() const;
+		Model_View<COORD> getCOORDView() const;
+		Model_View<PBUSH> getPBUSHView() const;
+		Model_View<PCOMP> getPCOMPView() const;
+		Model_View<PSHELL> getPSHELLView() const;
+		Model_View<MAT> getMATView() const;
+		Model_View<RBE2> getRBE2View() const;
+		Model_View<RBE3> getRBE3View() const;
+		Model_View<LOAD_CASE> getLOAD_CASEView() const;
+
+		//	Return a copy of the map to NASTRAN elements/grids stored on heap, the views avoid the copy
 		std::map<unsigned long, CQUAD*> getCQUADMap();
 		std::map<unsigned long, GRID*> getGRIDMap();
 		std::map<unsigned long, CBUSH*> getCBUSHMap();
@@ -61,12 +120,67 @@ class BASIC_MODEL
 		std::map<unsigned long, RBE2*> getRBE2Map();
 		std::map<unsigned long, LOAD_CASE*> getLOAD_CASEMap();
 
+		//	Set the card types loaded by parseModel, all card types are loaded by default
+		void setProfile(BDF_Profile profile);
+
+		//	Set the region loaded by parseModel, an empty region loads the whole model
+		void setRegion(BDF_Region region);
+
+		/*	Set a binary snapshot file used by parseModel. The model is loaded from the snapshot, only the model
+			files changed since it was written are parsed, and the snapshot is rewritten. Not used when a region
+			is set */
+		void setSnapshot(std::string snapshotName);
+
+		/*	Set the CQUADs, CBUSHes and subcases whose results are read by parsePunchFile, other results are
+			dropped as they are decoded. An empty filter keeps every result */
+		void setPunchFilter(Punch_Filter filter);
+
+		/*	Set whether QUAD4 composite ply stresses are read by parsePunchFile, they are not read by default.
+			Single precision stores them as float to halve their memory, any ply stresses held are removed */
+		void setPlyStress(bool Read, bool SinglePrecision);
+
+		/*	Freeze the GRIDs, CQUADs and CBUSHes into ID sorted arrays addressed by dense index, with a hash index
+			of the IDs when Hashed is set (the default). The model is frozen once loaded, the setting is kept
+			when it is refrozen */
+		void freezeModel(bool Hashed);
+
+		//	Write the parsed model to a binary snapshot, one section per model file, returns false if it could not be written
+		bool writeSnapshot(std::string snapshotName);
+
+		/*	Load the model from a binary snapshot written for the master file, re-parsing only the model files
+			that changed. Returns false if it does not exist, was written for another master file or profile,
+			or the changes need a full parse */
+		bool readSnapshot(std::string snapshotName, std::string fileName);
+
 		//	Parse master .bdf file 
 		void parseModel(std::string fileName);
 
-		//	Parse a results punch file
+		/*	Parse a results punch file. An index of the subcase blocks and result entries is written beside the
+			file (.idx), later reads of the same file only read the blocks and entries the punch filter keeps */
 		void parsePunchFile(std::string fileName);
 
+		/*	Parse a set of results punch files, the files and the subcase blocks of large files are decoded
+			concurrently and merged in the order given. Load cases and results are the same as parsing each
+			file in turn. Files with an .op2 extension are read as OP2 files */
+		void parsePunchFiles(std::vector<std::string> fileNames);
+
+		/*	Parse an OP2 binary results file. Static CQUAD4 and CBUSH element forces are read into the same
+			load cases and results as parsePunchFile */
+		void parseOP2File(std::string fileName);
+
+		/*	Open a set of results files to be read one subcase at a time, the load cases of the files are added
+			and no results are read. Punch files are indexed if they have no matching index, the subcase records
+			of OP2 files are indexed in the stream. Returns false without opening any file if a file is compressed */
+		bool openPunchStream(std::vector<std::string> fileNames, Punch_Stream &stream);
+
+		/*	Replace the results held by the model with the results of one subcase of an opened set of files,
+			the results are the same as the subcase read by parsePunchFiles. Returns false if a file opened by
+			the stream can no longer be opened or has changed size, the results of the subcase are incomplete */
+		bool parsePunchSubcase(Punch_Stream &stream, unsigned long SubcaseID);
+
+		//	Remove the results held by the model, the load cases are kept
+		void clearResults();
+
 	protected:
 		std::map<unsigned long, CQUAD*> CQUAD_Map;
 		std::map<unsigned long, GRID*> GRID_Map;
@@ -90,16 +204,83 @@ class BASIC_MODEL
 		std::map<unsigned long, RBE2*>::iterator RBE2_it;
 		std::map<unsigned long, RBE3*>::iterator RBE3_it;
 		std::map<unsigned long, LOAD_CASE*>::iterator LOAD_CASE_it;
+		Card_Arena<CQUAD> pCQUAD_Arena;
+		Card_Arena<GRID> pGRID_Arena;
+		Card_Arena<CBUSH> pCBUSH_Arena;
+		Card_Arena<COORD> pCOORD_Arena;
+		Card_Arena<PBUSH> pPBUSH_Arena;
+		Card_Arena<PCOMP> pPCOMP_Arena;
+		Card_Arena<PSHELL> pPSHELL_Arena;
+		Card_Arena<MAT> pMAT_Arena;
+		Card_Arena<RBE2> pRBE2_Arena;
+		Card_Arena<RBE3> pRBE3_Arena;
 		bool pBoolData[7];
 		std::string pStringData[7];
+		BDF_Profile pProfile;
+		BDF_Profile pPassProfile;
+		BDF_Region pRegion;
+		int pRegionPass;
+		std::string pSnapshotName;
+		Punch_Filter pPunchFilter;
+		Result_Store pCQUAD_Results;
+		Result_Store pCBUSH_Results;
+		Ply_Store pCQUAD_Plies;
+		bool pPlyStress;
+		bool pFrozen;
+		bool pElementsThawed;
+		bool pHashIndex;
+		ID_Index pGRID_Index;
+		ID_Index pCQUAD_Index;
+		ID_Index pCBUSH_Index;
+		std::vector<GRID*> pGRIDs;
+		std::vector<CQUAD*> pCQUADs;
+		std::vector<CBUSH*> pCBUSHes;
+		std::vector<BDF_Source> pSources;
+		unsigned long pDuplicates;
+		int pChangedFiles;
+		bool pParseIncludes;
+		void init();
+		void clearModel();
+		void connectCQUADs();
+		void freezeElements();
+		void refreezeElements();
+		void thawElements();
+		bool readModel(std::string fileName);
+		void parseRegion(std::string fileName);
 		std::string trim(std::string &str);
 		void checkBDFLine(std::string &str);
-		bool checkInclude(std::string &str, std::vector<std::string> &fileNames);
-		void checkLine(std::string &inputLine, std::vector<std::string> &lineEntries, unsigned int &inputType, bool &parseFlag, bool &longFormat);
-		void makeEntry(std::vector<std::string> &lineEntries, unsigned int &inputType, bool &longFormat);
-		unsigned long parseElementID(std::string &inputLine, bool &longFormat);
-		void checkLoadCase(std::vector<std::string> &lineEntries, int (&int_data)[3]);
-		void makeLoadEntry(std::vector<std::string> &lineEntries, int (&int_data)[3]);
+		bool checkInclude(BDF_Line &inputLine, std::vector<std::string> &fileNames);
+		void parseBDFFile(BDF_Buffer* buffer, Thread_Pool* pool);
+		void parseBDFRange(BDF_Buffer* buffer, std::shared_ptr<Mapped_File> bdfFile, const char* rangeStart, const char* rangeEnd, Thread_Pool* pool);
+		const char* findCardBoundary(const char* position, const char* fileEnd);
+		BDF_Buffer* parseSingleFile(std::string fileName);
+		void mergeFile(BDF_Buffer &buffer, BDF_Source &source);
+		void mergeBuffer(BDF_Buffer &buffer, BDF_Source &source);
+		void writeSection(Binary_Writer &writer, BDF_Source &source);
+		bool readSection(Binary_Reader &reader, BDF_Source &source);
+		bool patchConnectivity(BASIC_MODEL &stale, BDF_Source &added);
+		void checkLine(BDF_Line &inputLine, std::vector<BDF_Line> &lineEntries, unsigned int &inputType, bool &parseFlag, bool &longFormat, BDF_Buffer &buffer);
+		void makeEntry(std::vector<BDF_Line> &lineEntries, unsigned int &inputType, bool &longFormat, BDF_Buffer &buffer);
+		unsigned long parseElementID(BDF_Line &inputLine, bool &longFormat);
+		void decodePunchFile(Punch_Buffer* buffer, Thread_Pool* pool);
+		void decodePunchChunk(Punch_Buffer* buffer, std::function<void()> decode);
+		void queueNextFile(Punch_Buffer* buffer, Thread_Pool* pool);
+		void readPunchFile(Punch_Buffer* buffer, Thread_Pool* pool);
+		void parsePunchRange(Punch_Buffer* buffer, std::shared_ptr<Mapped_File> punchFile, const char* rangeStart, const char* rangeEnd);
+		void parseIndexedRange(Punch_Buffer* buffer, std::shared_ptr<Mapped_File> punchFile, std::shared_ptr<Punch_Index> index, std::size_t firstBlock, std::size_t lastBlock);
+		const char* findPunchBlock(const char* position, const char* fileEnd);
+		const char* decodePunchBlock(Punch_Buffer &buffer, const char* blockStart, const char* rangeEnd, Punch_Block* block);
+		void decodeIndexedBlock(Punch_Buffer &buffer, const char* fileBegin, Punch_Block &block);
+		void decodePunchEntry(Punch_Buffer &buffer, BDF_Line* entry, int elementType, unsigned long elementID);
+		void writePunchIndex(Punch_Buffer &buffer);
+		void mergePunch(Punch_Buffer &buffer);
+		bool reportPunch(Punch_Buffer &buffer);
+		void mergePunchResults(Punch_Buffer &buffer);
+		void mergePunchPart(Punch_Buffer &part);
+		void readOP2File(Punch_Buffer* buffer);
+		void readOP2Subcase(Punch_Buffer* buffer, std::shared_ptr<Mapped_File> op2File, std::shared_ptr<OP2_Index> index);
+		void decodeOP2Forces(Punch_Buffer &buffer, OP2_Record &ident, OP2_Record &data);
+		bool checkLoadCase(std::vector<std::string> &lineEntries, int (&int_data)[3], Punch_Buffer &buffer);
 		std::string ulong_to_str(unsigned long Num);
 		std::string int_to_str(int Num);
 		std::string double_to_str(double Num);
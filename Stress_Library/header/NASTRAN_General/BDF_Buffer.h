@@ -0,0 +1,79 @@
+/**
+ *
+ * @file		BDF_Buffer.h
+ * @author		Matt Guimarey
+ * @date		17/10/2026
+ * @version		1.0
+ *
+ * This class defines a buffer of the cards parsed from a single Bulk Data File
+ *
+ */
+
+#ifndef BDF_BUFFER_H
+#define BDF_BUFFER_H
+
+#include "CQUAD.h"
+#include "GRID.h"
+#include "CBUSH.h"
+#include "COORD.h"
+#include "PBUSH.h"
+#include "PCOMP.h"
+#include "PSHELL.h"
+#include "MAT.h"
+#include "RBE2.h"
+#include "RBE3.h"
+#include "Card_Arena.h"
+
+#include <string>
+#include <vector>
+#include <utility>
+
+class BDF_Buffer
+{
+	public:
+		BDF_Buffer();
+
+		//	Constructor setting the Bulk Data File the buffer is filled from
+		BDF_Buffer(std::string FileName);
+
+		//	Destroys any cards still held by the buffer arenas, its chunk buffers and the buffers of included files
+		~BDF_Buffer();
+
+		std::string fileName;									///< Path of the Bulk Data File
+		bool opened;											///< Flags whether the file was opened
+		std::vector<BDF_Buffer*> includes;						///< Buffers for the files included by this file, in order found
+		std::vector<BDF_Buffer*> chunks;						///< Buffers for the later byte ranges of a large file, in file order
+
+		//	Arenas owning the cards parsed into the buffer, moved to the model arenas when the buffer is merged
+		Card_Arena<CQUAD> CQUAD_Arena;
+		Card_Arena<GRID> GRID_Arena;
+		Card_Arena<CBUSH> CBUSH_Arena;
+		Card_Arena<COORD> COORD_Arena;
+		Card_Arena<PBUSH> PBUSH_Arena;
+		Card_Arena<PCOMP> PCOMP_Arena;
+		Card_Arena<PSHELL> PSHELL_Arena;
+		Card_Arena<MAT> MAT_Arena;
+		Card_Arena<RBE2> RBE2_Arena;
+		Card_Arena<RBE3> RBE3_Arena;
+
+		//	Cards in the order they appear in the file, paired with their ID
+		std::vector<std::pair<unsigned long, CQUAD*> > CQUAD_List;
+		std::vector<std::pair<unsigned long, GRID*> > GRID_List;
+		std::vector<std::pair<unsigned long, CBUSH*> > CBUSH_List;
+		std::vector<std::pair<unsigned long, COORD*> > COORD_List;
+		std::vector<std::pair<unsigned long, PBUSH*> > PBUSH_List;
+		std::vector<std::pair<unsigned long, PCOMP*> > PCOMP_List;
+		std::vector<std::pair<unsigned long, PSHELL*> > PSHELL_List;
+		std::vector<std::pair<unsigned long, MAT*> > MAT_List;
+		std::vector<std::pair<unsigned long, RBE2*> > RBE2_List;
+		std::vector<std::pair<unsigned long, RBE3*> > RBE3_List;
+
+		//	CQUAD ID, Property ID and corner GRIDs read in the topology pass of a region load, 6 entries per CQUAD
+		std::vector<unsigned long> CQUAD_Topology;
+
+	private:
+		BDF_Buffer(const BDF_Buffer&);
+		BDF_Buffer& operator=(const BDF_Buffer&);
+};
+
+#endif // BDF_BUFFER_H
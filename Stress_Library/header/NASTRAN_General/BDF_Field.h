@@ -0,0 +1,64 @@
+/**
+ *
+ * @file		BDF_Field.h
+ * @author		Matt Guimarey
+ * @date		17/10/2026
+ * @version		1.0
+ *
+ * This class defines a non-owning view of a single fixed width Bulk Data File field
+ *
+ */
+
+#ifndef BDF_FIELD_H
+#define BDF_FIELD_H
+
+#include <string>
+#include <cstddef>
+
+class BDF_Field
+{
+	public:
+		BDF_Field();
+
+		//	Constructor setting the view onto the field characters, leading and trailing blanks are trimmed
+		BDF_Field(const char* Data, std::size_t Length);
+
+		//	Constructor setting the view onto a string, the string must outlive the field
+		BDF_Field(const std::string &Data);
+
+		~BDF_Field();
+
+		//	Returns true if the field is blank
+		bool is_blank() const;
+
+		//	Returns true if the field contains a decimal point (real entry)
+		bool is_real() const;
+
+		//	Compares the trimmed field against text
+		bool compare(const char* text) const;
+
+		//	Returns the field as an integer, equivalent to atol on the field
+		long to_long() const;
+
+		/*	Returns the field as a real, equivalent to atof on the field with an implied exponent
+			('1.5-3' -> '1.5E-3') restored. Common forms are decoded directly, no heap allocation */
+		double to_double() const;
+
+		//	Returns a copy of the trimmed field
+		std::string str() const;
+
+		const char* data() const;
+		std::size_t length() const;
+
+	private:
+		const char* pData;		///< Pointer to the first non-blank character of the field in the file buffer
+		std::size_t pLength;	///< Number of characters in the trimmed field
+
+		//	Decodes [sign]digits[.digits][E|e][sign]digits directly, returns false for any other field
+		bool decode_real(double &value) const;
+
+		//	Converts the field with atof after restoring an implied exponent
+		double convert_real() const;
+};
+
+#endif // BDF_FIELD_H
@@ -0,0 +1,53 @@
+/**
+ *
+ * @file		BDF_Line.h
+ * @author		Matt Guimarey
+ * @date		17/10/2026
+ * @version		1.0
+ *
+ * This class defines a non-owning view of a single Bulk Data File line
+ *
+ */
+
+#ifndef BDF_LINE_H
+#define BDF_LINE_H
+
+#include <string>
+#include <cstddef>
+
+class BDF_Line
+{
+	public:
+		BDF_Line();
+
+		//	Constructor setting the view onto a line buffer (line terminators excluded)
+		BDF_Line(const char* Data, std::size_t Length);
+
+		~BDF_Line();
+
+		/*	Splits the next line from a buffer, cursor is advanced past the line terminator. Carriage
+			returns are stripped so DOS and UNIX line endings are treated alike */
+		static BDF_Line next_line(const char* &cursor, const char* end);
+
+		/*	Operator [] returns the character at column i, columns beyond the end of the line read as
+			blanks so short lines behave as if padded to 80 characters without copying them */
+		char operator[](std::size_t i) const { return i < pLength ? pData[i] : ' '; }
+
+		//	Returns a copy of the columns pos -> pos + len, padded with blanks beyond the end of the line
+		std::string substr(std::size_t pos, std::size_t len) const;
+
+		//	Compares the columns pos -> pos + len against text, blank padding is applied to both
+		bool compare_field(std::size_t pos, std::size_t len, const char* text) const;
+
+		//	Returns true if the first 8 columns are blank or a '*' followed by blanks (continuation line)
+		bool is_continuation() const;
+
+		const char* data() const;
+		std::size_t length() const;
+
+	private:
+		const char* pData;		///< Pointer to the first character of the line in the file buffer
+		std::size_t pLength;	///< Number of characters in the line
+};
+
+#endif // BDF_LINE_H
@@ -0,0 +1,47 @@
+/**
+ *
+ * @file		BDF_Profile.h
+ * @author		Matt Guimarey
+ * @date		17/10/2026
+ * @version		1.0
+ *
+ * This class defines the set of card types loaded from a Bulk Data File
+ *
+ */
+
+#ifndef BDF_PROFILE_H
+#define BDF_PROFILE_H
+
+#include <string>
+
+class BDF_Profile
+{
+	public:
+		//	Constructor for a profile loading every card type
+		BDF_Profile();
+
+		~BDF_Profile();
+
+		/*	Adds card types to the profile by name. Profile names: FULL -> every card type, FH -> card types used
+			by the filled hole analysis, PULL_THROUGH -> FH and PBUSH. Card names: CQUAD4, GRID, CBUSH, CORD2R,
+			PBUSH, PCOMP, PSHELL, MAT1 (or MAT8, both load MAT cards), RBE2, RBE3. Returns false if the name is
+			not recognised */
+		bool add(std::string name);
+
+		//	Removes card types from the profile by name, names as add
+		bool remove(std::string name);
+
+		//	Removes every card type from the profile
+		void clear();
+
+		/*	Returns true if the card type is loaded, types as numbered by BASIC_MODEL: 1 -> CQUAD4, 2 -> GRID,
+			3 -> CBUSH, 4 -> CORD2R, 5 -> PBUSH, 6 -> PCOMP, 7 -> PSHELL, 8 -> MAT1/MAT8, 9 -> RBE2, 10 -> RBE3 */
+		bool has_card(unsigned int cardType) const { return (pCards & (1u << cardType)) != 0; }
+
+		bool is_empty() const;
+
+	private:
+		unsigned int pCards;	///< Bit mask of loaded card types, bit n set -> card type n loaded
+};
+
+#endif // BDF_PROFILE_H
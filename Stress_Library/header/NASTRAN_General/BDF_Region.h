@@ -0,0 +1,74 @@
+/**
+ *
+ * @file		BDF_Region.h
+ * @author		Matt Guimarey
+ * @date		17/10/2026
+ * @version		1.0
+ *
+ * This class defines a region of interest of a model around selected fastener nodes
+ *
+ */
+
+#ifndef BDF_REGION_H
+#define BDF_REGION_H
+
+#include "GRID.h"
+#include "COORD.h"
+#include "RBE2.h"
+#include "RBE3.h"
+
+#include <vector>
+#include <map>
+#include <cstddef>
+
+class BDF_Region
+{
+	public:
+		//	Constructor for an empty region, an empty region loads the whole model
+		BDF_Region();
+
+		~BDF_Region();
+
+		//	Adds a fastener node the region is grown from
+		void add_node(unsigned long GridID);
+
+		//	Sets the region size as a number of CQUAD rings around each fastener node
+		void set_rings(int Rings);
+
+		//	Sets the region size as a distance from each fastener node, CQUADs with a corner GRID inside are kept
+		void set_distance(double Distance);
+
+		//	Returns true if no fastener nodes have been added
+		bool is_empty() const;
+
+		/*	Moves CQUAD topology read in the first pass into the region, 6 entries per CQUAD:
+			ID, Property ID, GRID 1 -> GRID 4. The vector is emptied on return */
+		void add_topology(std::vector<unsigned long> &Topology);
+
+		/*	Selects the CQUADs and properties inside the region from the topology. GRID RBE2 and RBE3
+			connectivity must be set, fastener nodes spidered to the plate are followed through the RBEs */
+		void select(std::map<unsigned long, GRID*> &GRID_Map, std::map<unsigned long, RBE2*> &RBE2_Map,
+				std::map<unsigned long, RBE3*> &RBE3_Map, std::map<unsigned long, COORD*> &COORD_Map);
+
+		//	Return true if the CQUAD or property is inside the region, valid after select
+		bool has_CQUAD(unsigned long ElementID) const;
+		bool has_property(unsigned long PropertyID) const;
+
+		//	Number of CQUADs read in the first pass and selected
+		std::size_t topology_size() const;
+		std::size_t CQUAD_size() const;
+
+	private:
+		std::vector<unsigned long> pNodes;			///< Fastener nodes the region is grown from
+		int pRings;									///< Number of CQUAD rings kept, used if pDistance is not positive
+		double pDistance;							///< Distance from the fastener nodes kept
+		std::vector<unsigned long> pTopology;		///< CQUAD ID, Property ID and corner GRIDs, 6 entries per CQUAD
+		std::vector<unsigned long> pCQUADs;			///< Sorted IDs of the selected CQUADs
+		std::vector<unsigned long> pProperties;		///< Sorted IDs of the properties of the selected CQUADs
+
+		//	Adds the nodes of RBE2 and RBE3 elements connected to the seed GRIDs
+		void add_rigid_nodes(std::vector<unsigned long> &Seeds, std::map<unsigned long, GRID*> &GRID_Map,
+				std::map<unsigned long, RBE2*> &RBE2_Map, std::map<unsigned long, RBE3*> &RBE3_Map);
+};
+
+#endif // BDF_REGION_H
@@ -0,0 +1,40 @@
+/**
+ *
+ * @file		BDF_Source.h
+ * @author		Matt Guimarey
+ * @date		17/10/2026
+ * @version		1.0
+ *
+ * This class records the cards a single Bulk Data File contributed to a model
+ *
+ */
+
+#ifndef BDF_SOURCE_H
+#define BDF_SOURCE_H
+
+#include <string>
+#include <vector>
+
+class BDF_Source
+{
+	public:
+		BDF_Source();
+
+		//	Constructor setting the Bulk Data File the cards were read from
+		BDF_Source(std::string FileName);
+
+		~BDF_Source();
+
+		std::string fileName;						///< Path of the Bulk Data File
+		bool hashed;								///< Flags whether size and hash are set
+		unsigned long long size;					///< Size of the file in bytes
+		unsigned long long hash;					///< Hash of the file content
+		std::vector<std::string> includes;			///< Files included by this file, in order found
+
+		/*	IDs of the cards loaded from the file, indexed by card type as numbered by BASIC_MODEL: 1 -> CQUAD4,
+			2 -> GRID, 3 -> CBUSH, 4 -> CORD2R, 5 -> PBUSH, 6 -> PCOMP, 7 -> PSHELL, 8 -> MAT1/MAT8, 9 -> RBE2,
+			10 -> RBE3. Cards dropped as duplicates of an earlier file are not recorded */
+		std::vector<unsigned long> cards[11];
+};
+
+#endif // BDF_SOURCE_H
@@ -0,0 +1,46 @@
+/**
+ *
+ * @file		BDF_Tokenizer.h
+ * @author		Matt Guimarey
+ * @date		17/10/2026
+ * @version		1.0
+ *
+ * This class splits the lines of a Bulk Data File card into fixed width fields
+ *
+ */
+
+#ifndef BDF_TOKENIZER_H
+#define BDF_TOKENIZER_H
+
+#include "BDF_Line.h"
+#include "BDF_Field.h"
+
+#include <vector>
+#include <cstddef>
+
+class BDF_Tokenizer
+{
+	public:
+		/*	Constructor setting the card lines and format. Short format cards have 8 fields of 8 columns
+			per line, long format cards have 4 fields of 16 columns per line. No fields are copied */
+		BDF_Tokenizer(const std::vector<BDF_Line> &Lines, bool LongFormat);
+
+		~BDF_Tokenizer();
+
+		/*	Returns data field i of the card counting across continuation lines, the card name is not
+			counted. Fields beyond the last line are returned blank */
+		BDF_Field field(std::size_t i) const;
+
+		//	Returns the card name field (columns 1 -> 8 of the first line)
+		BDF_Field name() const;
+
+		//	Number of data fields held by the card lines
+		std::size_t size() const;
+
+	private:
+		const std::vector<BDF_Line>* pLines;	///< Lines of the card
+		std::size_t pWidth;						///< Field width, 8 short format, 16 long format
+		std::size_t pFieldsPerLine;				///< Data fields per line, 8 short format, 4 long format
+};
+
+#endif // BDF_TOKENIZER_H
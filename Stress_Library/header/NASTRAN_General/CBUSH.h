@@ -20,6 +20,10 @@
 #include "LOAD_CASE.h"
 #include "Math/Transformation.h"
 #include "Math/Coordinate.h"
+#include "BDF_Line.h"
+#include "Result_Store.h"
+#include "IO/Binary_Writer.h"
+#include "IO/Binary_Reader.h"
 
 #include <vector>
 #include <string>
@@ -31,7 +35,7 @@ class CBUSH
 		CBUSH();
 
 		// 	Constructor parsing bdf data
-		CBUSH(std::vector<std::string> BDF_Data, bool LongFormatFlag);
+		CBUSH(std::vector<BDF_Line> &BDF_Data, bool LongFormatFlag);
 
 		// Constructor entering Element ID
 		CBUSH(unsigned long ElementID);
@@ -39,7 +43,7 @@ class CBUSH
 		~CBUSH();
 
 		// 	Parses BDF data based off a standard bulk data file, can set short or long format
-		void parseBDFData(std::vector<std::string> BDF_Data, bool LongFormatFlag);
+		void parseBDFData(std::vector<BDF_Line> &BDF_Data, bool LongFormatFlag);
 
 		//	Updates GRID entry with connectivity data -> sets this CBUSH ID as connected to GRID	
 		void nodeConnect(std::map<unsigned long, GRID*> &GRID_Map, std::map<unsigned long, RBE2*> &RBE2_Map);
@@ -52,7 +56,8 @@ class CBUSH
 /*		std::vector<unsigned long> get_FH_NodeA(); // Gets a vector of CQUAD IDs for Filled Hole at Fastener Node A
 		std::vector<unsigned long> get_FH_NodeB(); // Gets a vector of CQUAD IDs for Filled Hole at Fastener Node B
 */		// Punch Results Methods
-		void addForceResult(std::vector<std::string> lineEntries, unsigned long SubcaseID); // Adds a force result, line entry vector corresponds to a single force result
+		void attachResults(Result_Store* store); // Gives the CBUSH an element index in the model result store, results are added to and read from it
+		void addForceResult(const double* values, unsigned long SubcaseID); // Adds a force result, values are Fx, Fy, Fz, Mx, My, Mz
 		std::vector<Euclidean_Vector> getForceResult(unsigned long SubcaseID, bool as_is, unsigned long COORD_ID, std::map<unsigned long, COORD*> &COORD_Map, std::map<unsigned long, GRID*> &GRID_Map); // Gets a force result for the subcase ID
 		// FH Results Parse
 		void generate_FH_Result(std::map<unsigned long, CQUAD*> &CQUAD_Map, std::map<unsigned long, COORD*> &COORD_Map, std::map<unsigned long, GRID*> &GRID_Map, 
@@ -70,6 +75,10 @@ class CBUSH
 			2 -> Grid A ID, 3 -> Grid B ID, 4 -> Fastener Node A ID, 5 -> Fastener Node B ID, 6 -> OCID */
 		unsigned long operator[] (unsigned int i);
 
+		//	Write and read the model data of the class in a binary model snapshot, results are not included
+		void writeSnapshot(Binary_Writer &writer);
+		void readSnapshot(Binary_Reader &reader);
+
 	private:
 		unsigned long pLongData[7];			///< Unsigned long array, defined class data
 		double pS;							///< Double, location of CBUSH spring damper
@@ -85,12 +94,10 @@ class CBUSH
 		std::vector<CQUAD*> side_2[2];
 		std::vector<CQUAD*> side_3[2];
 		std::vector<CQUAD*> side_4[2];
-		std::map<unsigned long, Euclidean_Vector> Force_Res_Map[2];
+		Result_Store* pResults;				///< Force result store, Fx, Fy, Fz, Mx, My, Mz by subcase, NULL until attached
+		unsigned long pResultIndex;			///< Element index of the CBUSH in the result store
 		std::map<unsigned long, std::vector<double> > FH_Res_Map[2];
 
-		std::string check_exp(std::string &str);
-		bool checkReal(std::string &str);
-
 		void order_FH(std::map<unsigned long, GRID*> &GRID_Map, std::map<unsigned long, CQUAD*> &CQUAD_Map, std::map<unsigned long, COORD*> &COORD_Map, int &grid_size, int &side_no, unsigned int &axis_type);
 		void set_transform(std::map<unsigned long, COORD*> &COORD_Map, std::map<unsigned long, GRID*> &GRID_Map);
 };
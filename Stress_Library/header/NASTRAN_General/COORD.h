@@ -14,6 +14,9 @@
 
 #include "Math/Euclidean_Vector.h"
 #include "Math/Transformation.h"
+#include "BDF_Line.h"
+#include "IO/Binary_Writer.h"
+#include "IO/Binary_Reader.h"
 
 #include <vector>
 #include <string>
@@ -25,12 +28,12 @@ class COORD
 		COORD();
 
 		// 	Constructor parsing bdf data
-		COORD(std::vector<std::string> BDF_Data, bool LongFormatFlag);
+		COORD(std::vector<BDF_Line> &BDF_Data, bool LongFormatFlag);
 
 		~COORD();
 
 		// 	Parses BDF data based off a standard bulk data file, can set short or long format
-		void parseBDFData(std::vector<std::string> BDF_Data, bool LongFormatFlag);
+		void parseBDFData(std::vector<BDF_Line> &BDF_Data, bool LongFormatFlag);
 		
 		/*	Returns a euclidean vector for the selected axis of the transformation matrix, i = default -> x, 
 			1 -> y, 2 -> z. Inverse flag sets the output to be the inverse matrix. COORD_ID sets the defined 
@@ -46,13 +49,14 @@ class COORD
 		// 	Operator [] directly accesses COORD long data: i = 0 -> COORD ID, 1 -> Ref Coordinate System ID, 
 		unsigned long operator[](int i);
 
+		//	Write and read the class data in a binary model snapshot
+		void writeSnapshot(Binary_Writer &writer);
+		void readSnapshot(Binary_Reader &reader);
+
 	private:
 		unsigned long pLongData[2];			///< Unsigned Long Integer array storing Class Data
 		Coordinate pOrigin;					///< Coordinate point with coordinate system origin
 		Transformation pTransMatrices[2];	///< Transformation array storing class transformation matrix and inverse trans matrix
-
-		//	Private function that checks string data for exponent
-		std::string check_exp(std::string &str);
 };
 
 #endif // COORD_H
@@ -20,6 +20,11 @@
 #include "Math/Euclidean_Vector.h"
 #include "Math/Coordinate.h"
 #include "Stress/CAUCHY_STRESS.h"
+#include "BDF_Line.h"
+#include "Result_Store.h"
+#include "Ply_Store.h"
+#include "IO/Binary_Writer.h"
+#include "IO/Binary_Reader.h"
 
 #include <string>
 #include <vector>
@@ -31,7 +36,7 @@ class CQUAD
 		CQUAD();
 
         // 	Constructor parsing bdf data
-		CQUAD(std::vector<std::string> BDF_Data, bool LongFormatFlag);
+		CQUAD(std::vector<BDF_Line> &BDF_Data, bool LongFormatFlag);
 
         // 	Constructor setting element ID
 		CQUAD(unsigned long ElementID);
@@ -39,7 +44,7 @@ class CQUAD
 		~CQUAD();
 
         // 	Parses BDF data based off a standard bulk data file, can set short or long format
-		void parseBDFData(std::vector<std::string> BDF_Data, bool LongFormatFlag);
+		void parseBDFData(std::vector<BDF_Line> &BDF_Data, bool LongFormatFlag);
 
         /*  Functions return a coordinate point (class) representing the centroid of the CQUAD element. The 
             coordinate frame ID should be specified (0 being BASIC coordinate system) */
@@ -60,12 +65,23 @@ class CQUAD
 		//	Updates GRID entry with connectivity data -> sets this CQUAD ID as connected to GRID
 		void nodeConnect(std::map<unsigned long, GRID*> &GRID_Map, std::map<unsigned long, COORD*> &COORD_Map);
 
+		//	As nodeConnect with the GRIDs of the four nodes already found, a node not in the model is NULL
+		void nodeConnect(GRID* (&grids)[4], std::map<unsigned long, COORD*> &COORD_Map);
+
+		//	Returns true if the other CQUAD was parsed from the same card data, connectivity data is not compared
+		bool sameBDFData(CQUAD &other);
+
 		Euclidean_Vector get_material_vector();
 
 		// Punch Results Methods
-		void addForceResult(std::vector<std::string> lineEntries, unsigned long SubcaseID, bool in_mat); // Adds a force result, line entry vector corresponds to a single force result
+		void attachResults(Result_Store* store); // Gives the CQUAD an element index in the model result store, results are added to and read from it
+		void addForceResult(const double* values, unsigned long SubcaseID, bool in_mat); // Adds a force result, values are Nx, Ny, Nxy, Mx, My, Mxy, Vx, Vy
 		std::vector<double> getForceResult(unsigned long SubcaseID, bool in_mat, Euclidean_Vector* default_vector, std::map<unsigned long, GRID*> &GRID_Map, 
 											std::map<unsigned long, COORD*> &COORD_Map);
+		void attachPlyResults(Ply_Store* store); // Gives the CQUAD an element index in the model ply result store
+		void addPlyStressResult(const double* values, unsigned int Ply, unsigned long SubcaseID); // Adds a ply stress result, values are S1, S2, S12, S1Z, S2Z, Angle, Major, Minor, Max Shear
+		unsigned int getPlyCount(unsigned long SubcaseID); // Number of plies with a stress result for the subcase
+		bool getPlyStressResult(unsigned long SubcaseID, unsigned int Position, unsigned int &Ply, double* values); // Ply stress result at Position, 0 -> getPlyCount - 1, false if there is none
 
 		/*	Operator [] provides access to unsigned long data: i = 0/default -> Element ID, 1 -> Property ID, 
             2 -> Grid 1 ID, 3 -> Grid 2 ID, 4 -> Grid 3 ID, 5 -> Grid 4 ID, 6 -> MCID */
@@ -76,21 +92,22 @@ class CQUAD
 			The validity of double data is not guaranteed as that is based off input from bulk data file */
         double operator()(int i);
 
+		//	Write and read the model data of the class in a binary model snapshot, results are not included
+		void writeSnapshot(Binary_Writer &writer);
+		void readSnapshot(Binary_Reader &reader);
+
 	private:
 		unsigned long pLongData[7];     											///< Unisigned long data array storing class data
 		double pDoubleData[4];          											///< double data array storing class data
 		bool pBoolData[4];              											///< bool storing flags determining validity state of other variables
         Coordinate pCentroid;           											///< Coordinate point, the CQUAD centroid
-		std::map<unsigned long, std::pair<CAUCHY_STRESS, bool> > N_Map;				///< Map of CAUCHY_STRESS results representing in-plane forces
-		std::map<unsigned long, std::pair<CAUCHY_STRESS, bool> > M_Map;				///< Map of CAUCHY_STRESS results representing moments
-		std::map<unsigned long, std::pair<std::vector<double>, bool> > V_Map;		///< Map of std::vector storing out of plane forces Vx, Vy
+		Result_Store* pResults;														///< Force result store, Nx, Ny, Nxy, Mx, My, Mxy, Vx, Vy by subcase, NULL until attached
+		unsigned long pResultIndex;													///< Element index of the CQUAD in the result store
+		Ply_Store* pPlyResults;														///< Ply stress store, S1, S2, S12, S1Z, S2Z, Angle, Major, Minor, Max Shear by subcase and ply, NULL until attached
+		unsigned long pPlyIndex;													///< Element index of the CQUAD in the ply stress store
 		double beta, gamma, alpha, elm_theta, mat_angle;							///< CQUAD internal angles used for result output
 		Euclidean_Vector x_elm, y_elm, plane_normal;
 
-
-		std::string check_exp(std::string &str);
-		bool checkReal(std::string &str);
-
 };
 
 #endif // CQUAD_H
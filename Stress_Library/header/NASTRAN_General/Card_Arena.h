@@ -0,0 +1,130 @@
+/**
+ *
+ * @file		Card_Arena.h
+ * @author		Matt Guimarey
+ * @date		17/10/2026
+ * @version		1.0
+ *
+ * This class defines an arena owning the parsed cards of one type, cards are stored in blocks in the order created
+ *
+ */
+
+#ifndef CARD_ARENA_H
+#define CARD_ARENA_H
+
+#include <vector>
+#include <new>
+#include <utility>
+#include <cstddef>
+#include <type_traits>
+
+#define CARD_ARENA_BLOCK_BYTES 65536	// Bytes of card storage per block
+
+template <class T>
+class Card_Arena
+{
+	public:
+		Card_Arena()
+		{
+			pSize = 0;
+		}
+
+		//	Destroys every card still held and frees the blocks
+		~Card_Arena()
+		{
+			clear();
+		}
+
+		//	Constructs a card in the next free slot, the card stays at the same address until it is destroyed
+		template <class... Args>
+		T* create(Args&&... args)
+		{
+			if (pBlocks.empty() || pBlocks.back().used == pBlocks.back().capacity) {
+				Block block;
+				block.capacity = CARD_ARENA_BLOCK_BYTES / sizeof(Slot) > 0 ? CARD_ARENA_BLOCK_BYTES / sizeof(Slot) : 1;
+				block.used = 0;
+				block.slots = new Slot[block.capacity];
+				pBlocks.push_back(block);
+			}
+			Slot &slot = pBlocks.back().slots[pBlocks.back().used];
+			T* card = new (&slot.data) T(std::forward<Args>(args)...);
+			slot.live = true;
+			pBlocks.back().used++;
+			pSize++;
+			return card;
+		}
+
+		/*	Destroys a card created by any arena of the type, as delete would. The slot is not reused, its memory
+			is freed with the block */
+		static void destroy(T* card)
+		{
+			Slot* slot = reinterpret_cast<Slot*>(card);
+			if (slot->live) {
+				card->~T();
+				slot->live = false;
+			}
+		}
+
+		//	Moves the blocks of another arena to the end of this one, the cards keep their addresses
+		void splice(Card_Arena &other)
+		{
+			pBlocks.insert(pBlocks.end(), other.pBlocks.begin(), other.pBlocks.end());
+			pSize += other.pSize;
+			other.pBlocks.clear();
+			other.pSize = 0;
+		}
+
+		//	Destroys every card still held in creation order and frees the blocks
+		void clear()
+		{
+			for (std::size_t i = 0; i < pBlocks.size(); i++) {
+				for (std::size_t j = 0; j < pBlocks[i].used; j++) {
+					Slot &slot = pBlocks[i].slots[j];
+					if (slot.live) {
+						reinterpret_cast<T*>(&slot.data)->~T();
+					}
+				}
+				delete[] pBlocks[i].slots;
+			}
+			pBlocks.clear();
+			pSize = 0;
+		}
+
+		//	Number of cards created, including any destroyed since
+		std::size_t size() const
+		{
+			return pSize;
+		}
+
+		//	Number of blocks held
+		std::size_t block_count() const
+		{
+			return pBlocks.size();
+		}
+
+	private:
+		//	Storage of one card, the card is at the start of the slot so a card pointer is its slot
+		class Slot
+		{
+			public:
+				typename std::aligned_storage<sizeof(T), std::alignment_of<T>::value>::type data;
+				bool live;
+		};
+
+		//	A block of slots, filled in order
+		class Block
+		{
+			public:
+				Slot* slots;
+				std::size_t capacity;
+				std::size_t used;
+		};
+
+		std::vector<Block> pBlocks;				///< Blocks in the order created or spliced
+		std::size_t pSize;						///< Number of cards created
+
+		Card_Arena(const Card_Arena&);
+		Card_Arena& operator=(const Card_Arena&);
+};
+
+#endif // CARD_ARENA_H
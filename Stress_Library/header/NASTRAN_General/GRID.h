@@ -14,6 +14,9 @@
 
 #include "COORD.h"
 #include "Math/Coordinate.h"
+#include "BDF_Line.h"
+#include "IO/Binary_Writer.h"
+#include "IO/Binary_Reader.h"
 
 #include <vector>
 #include <string>
@@ -25,7 +28,7 @@ class GRID
 		GRID();
 
 		// 	Constructor parsing bdf data
-		GRID(std::vector<std::string> BDF_data, bool long_format_flag);
+		GRID(std::vector<BDF_Line> &BDF_data, bool long_format_flag);
 		
 		// 	Constructor entring a grid ID
 		GRID(unsigned long grid_ID);
@@ -33,7 +36,7 @@ class GRID
 		~GRID();
 
 		// 	Parses BDF data based off a standard bulk data file, can set short or long format
-		void parse_BDF_data(std::vector<std::string> BDF_data, bool long_format_flag);
+		void parse_BDF_data(std::vector<BDF_Line> &BDF_data, bool long_format_flag);
 		
 		//	Get a coordinate class for the coordinate points in specified coordinate system ID
 		Coordinate get_coordinate(unsigned long COORD_ID, std::map<unsigned long, COORD*> &COORD_Map);
@@ -49,6 +52,15 @@ class GRID
 
 		//	Adds the RBE3 ID to the list of RBE3 elements connected to this GRID
 		bool addRBE3_Connect(unsigned long ElementID);	
+
+		//	Removes the element ID from the list of elements of that type connected to this GRID
+		bool removeCQUAD_Connect(unsigned long ElementID);
+		bool removeCBUSH_Connect(unsigned long ElementID);
+		bool removeRBE2_Connect(unsigned long ElementID);
+		bool removeRBE3_Connect(unsigned long ElementID);
+
+		//	Sorts the connectivity lists into element ID order, the order a full model parse builds them in
+		void sortConnect();
 		
 		//	Gets the list of RBE2 elements connected to this GRID
 		std::vector<unsigned long> getRBE2_List();
@@ -68,6 +80,11 @@ class GRID
 
 		/* 	Operator () directly accesses coordinate point locations: i = 0 -> x, 1 -> y, 2 -> z */
 		double operator()(int i);
+
+		//	Write and read the class data in a binary model snapshot
+		void writeSnapshot(Binary_Writer &writer);
+		void readSnapshot(Binary_Reader &reader);
+
 	private:
 		unsigned long pLongData[3];					///< Unsigned Long Integer array storing Class Data
 		Coordinate pCoordinate;						///< Coordinate point data
@@ -76,9 +93,6 @@ class GRID
 		std::vector<unsigned long> pRBE2_List;
 		std::vector<unsigned long> pRBE3_List;
 		/*std::map<unsigned long, std::vector<std::pair<std::pair<std::vector<double>, std::string> , unsigned long> > > GPF_Map;*/
-		
-		//	Private function that checks string data for exponent
-		std::string check_exp(std::string &str);	
 };
 
 
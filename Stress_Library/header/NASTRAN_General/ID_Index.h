@@ -0,0 +1,49 @@
+/**
+ *
+ * @file		ID_Index.h
+ * @author		Matt Guimarey
+ * @date		17/10/2026
+ * @version		1.0
+ *
+ * This class maps the IDs of a frozen set of model entries to dense indices
+ *
+ */
+
+#ifndef ID_INDEX_H
+#define ID_INDEX_H
+
+#include <vector>
+
+class ID_Index
+{
+	public:
+		ID_Index();
+
+		~ID_Index();
+
+		/*	Builds the index from IDs in ascending order with no repeats, the dense index of an ID is its
+			position. A hash table is built alongside the sorted IDs when Hashed is set */
+		void build(const std::vector<unsigned long> &IDs, bool Hashed);
+
+		//	Sets Index to the dense index of an ID, returns false if the ID is not in the index
+		bool find(unsigned long ID, unsigned long &Index) const;
+
+		//	Returns the ID at a dense index
+		unsigned long id_at(unsigned long Index) const;
+
+		//	Number of IDs in the index
+		unsigned long size() const;
+
+		//	Returns true if the index has a hash table
+		bool is_hashed() const;
+
+		//	Removes every ID
+		void clear();
+
+	private:
+		std::vector<unsigned long> pIDs;		///< IDs in ascending order, the position is the dense index
+		std::vector<unsigned long> pSlots;		///< Hash table, dense index + 1 of the ID in each slot, 0 -> empty
+		int pShift;								///< Right shift of the 64 bit hash product giving a slot
+};
+
+#endif // ID_INDEX_H
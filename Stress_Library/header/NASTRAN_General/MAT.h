@@ -12,6 +12,10 @@
 #ifndef MAT_H
 #define MAT_H
 
+#include "BDF_Line.h"
+#include "IO/Binary_Writer.h"
+#include "IO/Binary_Reader.h"
+
 #include <vector>
 #include <string>
 
@@ -21,12 +25,12 @@ class MAT
 		MAT();
 
 		// 	Constructor parsing bdf data
-		MAT(std::vector<std::string> BDF_Data, bool LongFormatFlag);
+		MAT(std::vector<BDF_Line> &BDF_Data, bool LongFormatFlag);
 
 		~MAT();
 
 		// 	Parses BDF data based off a standard bulk data file, can set short or long format
-		void parseBDFData(std::vector<std::string> BDF_Data, bool LongFormatFlag);
+		void parseBDFData(std::vector<BDF_Line> &BDF_Data, bool LongFormatFlag);
 
 		unsigned long getMaterialID();
 
@@ -37,11 +41,14 @@ class MAT
 			3 -> G12, 4 -> G13, 5 -> G23, 6-> RHO, 7 -> A1, 8 -> A2 */	
 		double operator[] (unsigned int i);	
 
+		//	Write and read the class data in a binary model snapshot
+		void writeSnapshot(Binary_Writer &writer);
+		void readSnapshot(Binary_Reader &reader);
+
 	private:
 		unsigned long pMaterialID;		///< Unsigned long, material ID
 		double pDoubleData[9];			///< Double data array holding material properties
 		unsigned short pMaterialType;	///< Unsigned short, material type 1 -> MAT1, 2 -> MAT8
-		std::string check_exp(std::string &str);
 };
 
 #endif // MAT_H
@@ -0,0 +1,163 @@
+/**
+ *
+ * @file		Model_View.h
+ * @author		Matt Guimarey
+ * @date		17/10/2026
+ * @version		1.0
+ *
+ * This class defines a read-only view of the cards of one type held by a model, no cards or map nodes are copied
+ *
+ */
+
+#ifndef MODEL_VIEW_H
+#define MODEL_VIEW_H
+
+#include <map>
+#include <utility>
+#include <iterator>
+#include <cstddef>
+
+//	Iterator over the cards of a view in ID order, each entry pairs the ID with a const pointer to the card
+template <class T>
+class Model_View_Iterator
+{
+	public:
+		typedef std::forward_iterator_tag iterator_category;
+		typedef std::pair<unsigned long, const T*> value_type;
+		typedef std::ptrdiff_t difference_type;
+		typedef const value_type* pointer;
+		typedef value_type reference;
+
+		Model_View_Iterator()
+		{
+
+		}
+
+		Model_View_Iterator(typename std::map<unsigned long, T*>::const_iterator Position)
+		{
+			pPosition = Position;
+		}
+
+		value_type operator*() const
+		{
+			return value_type(pPosition->first, pPosition->second);
+		}
+
+		//	The entry pointed to is held by the iterator, it is replaced on the next use
+		const value_type* operator->() const
+		{
+			pEntry = **this;
+			return &pEntry;
+		}
+
+		Model_View_Iterator& operator++()
+		{
+			++pPosition;
+			return *this;
+		}
+
+		Model_View_Iterator operator++(int)
+		{
+			Model_View_Iterator previous = *this;
+			++pPosition;
+			return previous;
+		}
+
+		bool operator==(const Model_View_Iterator &other) const
+		{
+			return pPosition == other.pPosition;
+		}
+
+		bool operator!=(const Model_View_Iterator &other) const
+		{
+			return pPosition != other.pPosition;
+		}
+
+	private:
+		typename std::map<unsigned long, T*>::const_iterator pPosition;		///< Entry of the map viewed
+		mutable value_type pEntry;											///< Entry returned by operator->
+};
+
+template <class T>
+class Model_View
+{
+	public:
+		typedef Model_View_Iterator<T> const_iterator;
+
+		/*	Constructor viewing every card of a map. The map is read each time the view is used, so the view follows
+			cards added to or removed from the model and is valid while the map exists */
+		Model_View(const std::map<unsigned long, T*> &Map)
+		{
+			pMap = &Map;
+			pWhole = true;
+			pFirstID = 0;
+			pLastID = 0;
+		}
+
+		//	Return a pointer to the card with an ID in the view, NULL if not found
+		const T* find(unsigned long ID) const
+		{
+			if (!in_range(ID)) {
+				return NULL;
+			}
+			typename std::map<unsigned long, T*>::const_iterator found = pMap->find(ID);
+			return found != pMap->end() ? found->second : NULL;
+		}
+
+		//	Returns true if a card with the ID is in the view
+		bool contains(unsigned long ID) const
+		{
+			return find(ID) != NULL;
+		}
+
+		//	Return a view of the cards with IDs from FirstID to LastID inclusive, within this view
+		Model_View range(unsigned long FirstID, unsigned long LastID) const
+		{
+			Model_View view(*pMap);
+			view.pWhole = false;
+			view.pFirstID = pWhole || FirstID > pFirstID ? FirstID : pFirstID;
+			view.pLastID = pWhole || LastID < pLastID ? LastID : pLastID;
+			return view;
+		}
+
+		//	Iterators over the cards in ID order, a range view finds its first and last card on each call
+		const_iterator begin() const
+		{
+			if (pWhole) {
+				return const_iterator(pMap->begin());
+			}
+			return pFirstID > pLastID ? end() : const_iterator(pMap->lower_bound(pFirstID));
+		}
+
+		const_iterator end() const
+		{
+			if (pWhole || pFirstID > pLastID) {
+				return const_iterator(pMap->end());
+			}
+			return const_iterator(pMap->upper_bound(pLastID));
+		}
+
+		//	Number of cards in the view, counted by walking a range
+		std::size_t size() const
+		{
+			return pWhole ? pMap->size() : (std::size_t)std::distance(begin(), end());
+		}
+
+		bool empty() const
+		{
+			return begin() == end();
+		}
+
+	private:
+		const std::map<unsigned long, T*>* pMap;	///< Map of the model viewed
+		bool pWhole;								///< True if the view holds the whole map
+		unsigned long pFirstID;						///< Lowest ID of a range view
+		unsigned long pLastID;						///< Highest ID of a range view
+
+		bool in_range(unsigned long ID) const
+		{
+			return pWhole || (ID >= pFirstID && ID <= pLastID);
+		}
+};
+
+#endif // MODEL_VIEW_H
@@ -0,0 +1,109 @@
+/**
+ *
+ * @file		OP2_Reader.h
+ * @author		Matt Guimarey
+ * @date		17/10/2026
+ * @version		1.0
+ *
+ * This class walks the tables and records of a NASTRAN OP2 binary results file held in memory
+ *
+ */
+
+#ifndef OP2_READER_H
+#define OP2_READER_H
+
+#include <string>
+#include <vector>
+#include <map>
+#include <cstddef>
+
+/*	A logical OP2 record. Large records are written as several Fortran blocks, the record points at the
+	blocks in the file and no data is copied */
+class OP2_Record
+{
+	public:
+		OP2_Record();
+
+		~OP2_Record();
+
+		//	Number of 4 byte words in the record
+		std::size_t words() const;
+
+		//	Returns word i as an integer or a single precision real, 0 past the end of the record
+		int int_at(std::size_t i);
+		float float_at(std::size_t i);
+
+		//	Returns count characters starting at word i, shorter past the end of the record
+		std::string string_at(std::size_t i, std::size_t count);
+
+		/*	Returns a pointer to entry i of a record made of entries numWide words long. An entry inside a
+			single block is returned in place, an entry split across blocks is copied into scratch, which
+			must hold numWide words. Entries are fastest read in order */
+		const char* entry(std::size_t i, int numWide, char* scratch);
+
+		//	Removes all blocks
+		void clear();
+
+		//	Adds a block of words to the end of the record
+		void add_block(const char* data, std::size_t words);
+
+	private:
+		std::vector<const char*> pBlocks;		///< Start of each block in the file
+		std::vector<std::size_t> pStarts;		///< Word offset of each block in the record, with the total words last
+		std::size_t pBlock;						///< Block holding the last word found, where the next search starts
+
+		const char* word(std::size_t i);
+};
+
+/*	Offsets of the element force ident records of each subcase of an OP2 file, found while the file is listed so
+	one subcase can be read without walking the file */
+class OP2_Index
+{
+	public:
+		OP2_Index();
+
+		~OP2_Index();
+
+		unsigned long long size;											///< Size of the OP2 file in bytes
+		std::map<unsigned long, std::vector<std::size_t> > subcases;		///< Byte offsets of the ident records of each subcase, in file order
+};
+
+class OP2_Reader
+{
+	public:
+		//	Constructor for a reader of the OP2 file held between begin and end
+		OP2_Reader(const char* begin, const char* end);
+
+		~OP2_Reader();
+
+		/*	Reads the file header if there is one. Returns false if the file is not a little endian OP2 file
+			with 4 byte words, the only layout read */
+		bool read_header();
+
+		//	Moves to the next table and reads its name and header records, returns false at the end of the file
+		bool next_table(std::string &tableName);
+
+		//	Reads the next record of the current table, returns false at the end of the table
+		bool next_record(OP2_Record &record);
+
+		//	Returns false once a block or marker running past the end of the file has been found
+		bool is_valid();
+
+		//	Byte offset of the next Fortran block from the start of the file
+		std::size_t position();
+
+		//	Moves to a byte offset returned by position, returns false if it is past the end of the file
+		bool seek(std::size_t offset);
+
+	private:
+		const char* pBegin;			///< Start of the file
+		const char* pCursor;		///< Start of the next Fortran block
+		const char* pEnd;			///< End of the file
+		bool pValid;				///< Flags whether the file read so far is well formed
+
+		bool read_marker(int &marker);
+		bool peek_marker(int &marker, int ahead);
+		bool read_block(std::size_t words, const char* &data);
+};
+
+#endif // OP2_READER_H
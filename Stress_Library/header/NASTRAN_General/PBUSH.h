@@ -12,6 +12,10 @@
 #ifndef PBUSH_H
 #define PBUSH_H
 
+#include "BDF_Line.h"
+#include "IO/Binary_Writer.h"
+#include "IO/Binary_Reader.h"
+
 #include <vector>
 #include <string>
 
@@ -21,12 +25,12 @@ class PBUSH
 		PBUSH();
 
 		// 	Constructor parsing bdf data
-		PBUSH(std::vector<std::string> BDF_Data, bool LongFormatFlag);
+		PBUSH(std::vector<BDF_Line> &BDF_Data, bool LongFormatFlag);
 
 		~PBUSH();
 
 		// 	Parses BDF data based off a standard bulk data file, can set short or long format
-		void parseBDFData(std::vector<std::string> BDF_Data, bool LongFormatFlag);
+		void parseBDFData(std::vector<BDF_Line> &BDF_Data, bool LongFormatFlag);
 
 		unsigned long getPropertyID();
 
@@ -34,11 +38,13 @@ class PBUSH
 			3 -> K4, 4 -> K5, 5 -> K6 */ 
 		double operator[] (unsigned int i);
 
+		//	Write and read the class data in a binary model snapshot
+		void writeSnapshot(Binary_Writer &writer);
+		void readSnapshot(Binary_Reader &reader);
+
 	private:
 		unsigned long pLongData[1];		///< Unisigned long data array storing class data
 		double pDoubleData[6];			///< Double data array storing class data
-
-		std::string check_exp(std::string &str);
 };
 
 #endif //PBUSH_H
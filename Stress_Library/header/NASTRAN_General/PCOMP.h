@@ -13,6 +13,9 @@
 #define PCOMP_H
 
 #include "MAT.h"
+#include "BDF_Line.h"
+#include "IO/Binary_Writer.h"
+#include "IO/Binary_Reader.h"
 #include <map>
 #include <vector>
 #include <string>
@@ -23,12 +26,12 @@ class PCOMP
 		PCOMP();
 
 		// 	Constructor parsing bdf data
-		PCOMP(std::vector<std::string> BDF_Data, bool LongFormatFlag); 
+		PCOMP(std::vector<BDF_Line> &BDF_Data, bool LongFormatFlag); 
 
 		~PCOMP();
 
 		// 	Parses BDF data based off a standard bulk data file, can set short or long format
-		void parseBDFData(std::vector<std::string> BDF_Data, bool LongFormatFlag);
+		void parseBDFData(std::vector<BDF_Line> &BDF_Data, bool LongFormatFlag);
 
 		unsigned long getPropertyID();
 		double getZOff();
@@ -40,6 +43,10 @@ class PCOMP
 			3 -> NU21, 4 -> G12, 5 -> t */ 
 		double operator[] (unsigned int i);
 
+		//	Write and read the class data in a binary model snapshot
+		void writeSnapshot(Binary_Writer &writer);
+		void readSnapshot(Binary_Reader &reader);
+
 	private:
 		unsigned long pPropertyID;					///< Unsigned long, PCOMP propetry ID
 		double pZOff;								///< Double, 1st ply location with respect to element plane
@@ -51,7 +58,6 @@ class PCOMP
 		double B_Matrix[3][3];
 		double D_Matrix[3][3];
 		double Laminate_Stiffness[6];				///< Double array with PCOMP laminate stiffness properties
-		std::string check_exp(std::string &str);
 };
 
 #endif // PCOMP_H
@@ -12,6 +12,10 @@
 #ifndef PSHELL_H
 #define PSHELL_H
 
+#include "BDF_Line.h"
+#include "IO/Binary_Writer.h"
+#include "IO/Binary_Reader.h"
+
 #include <vector>
 #include <string>
 
@@ -21,12 +25,12 @@ class PSHELL
 		PSHELL();
 
 		// 	Constructor parsing bdf data
-		PSHELL(std::vector<std::string> BDF_Data, bool LongFormatFlag);
+		PSHELL(std::vector<BDF_Line> &BDF_Data, bool LongFormatFlag);
 
 		~PSHELL();
 
 		// 	Parses BDF data based off a standard bulk data file, can set short or long format
-		void parseBDFData(std::vector<std::string> BDF_Data, bool LongFormatFlag);
+		void parseBDFData(std::vector<BDF_Line> &BDF_Data, bool LongFormatFlag);
 
 		/*	Operator [] provides access to unsigned long data: i = 0/default -> Property ID, 1 -> Material 1 ID, 
             2 -> Material 2 ID, 3 -> Material 3 ID */
@@ -36,11 +40,13 @@ class PSHELL
 			Thickness Ratio  */
 		double operator() (unsigned int i);
 
+		//	Write and read the class data in a binary model snapshot
+		void writeSnapshot(Binary_Writer &writer);
+		void readSnapshot(Binary_Reader &reader);
+
 	private:
 		unsigned long pLongData[4];		///< Unisigned long data array storing class data
 		double pDoubleData[3];			///< Double data array storing class data
-
-		std::string check_exp(std::string &str);
 };
 
 #endif // PSHELL_H
@@ -0,0 +1,74 @@
+/**
+ *
+ * @file		Ply_Store.h
+ * @author		Matt Guimarey
+ * @date		17/10/2026
+ * @version		1.0
+ *
+ * This class stores the punch file ply results of composite elements in columns
+ *
+ */
+
+#ifndef PLY_STORE_H
+#define PLY_STORE_H
+
+#include <vector>
+#include <map>
+
+class Ply_Store
+{
+	public:
+		Ply_Store();
+
+		/*	Constructor for a store holding Components result values per ply, element and subcase. Single
+			precision stores the values as float, halving the memory of the store */
+		Ply_Store(int Components, bool SinglePrecision);
+
+		~Ply_Store();
+
+		//	Returns the dense index of a new element, elements are numbered in the order they are added
+		unsigned long add_element();
+
+		/*	Adds the result values of a ply of an element for a subcase. The plies of an element are kept when
+			they are added one after another, a ply already held or added after another element's plies is
+			dropped */
+		void add_result(unsigned long Index, unsigned long SubcaseID, unsigned int Ply, const double* values);
+
+		//	Returns the number of plies held for an element and subcase
+		unsigned int ply_count(unsigned long Index, unsigned long SubcaseID) const;
+
+		/*	Sets Ply and values to the ply at Position, 0 -> ply_count - 1, of an element for a subcase. Returns
+			false if there is no ply at Position */
+		bool get_result(unsigned long Index, unsigned long SubcaseID, unsigned int Position, unsigned int &Ply, double* values) const;
+
+		//	Number of elements, subcases and ply results in the store
+		unsigned long element_count() const;
+		unsigned long subcase_count() const;
+		unsigned long row_count() const;
+
+		//	Returns true if values are stored as float
+		bool single_precision() const;
+
+		//	Removes all elements and results, the number of components and precision are kept
+		void clear();
+
+		//	Removes the results of every subcase, elements keep their indices
+		void clear_results();
+
+	private:
+		int pComponents;												///< Number of result values per ply
+		bool pSinglePrecision;											///< Flags whether values are stored as float
+		unsigned long pElements;										///< Number of element indices handed out
+		std::map<unsigned long, unsigned long> pSubcaseIndex;			///< Dense index of each subcase ID
+		/*	Rows of each subcase index, one per ply in the order added. pFirst holds the first row + 1 of each
+			element, 0 -> no plies, and is sized up to the last element with a result */
+		std::vector<std::vector<unsigned long> > pFirst;
+		std::vector<std::vector<unsigned short> > pCount;
+		std::vector<std::vector<unsigned int> > pPlies;
+		std::vector<unsigned long> pLastIndex;							///< Element of the last row of each subcase index
+		//	Value columns laid out [subcase index * pComponents + component][row], only one precision is used
+		std::vector<std::vector<float> > pFloats;
+		std::vector<std::vector<double> > pDoubles;
+};
+
+#endif // PLY_STORE_H
@@ -0,0 +1,96 @@
+/**
+ *
+ * @file		Punch_Buffer.h
+ * @author		Matt Guimarey
+ * @date		17/10/2026
+ * @version		1.0
+ *
+ * This class defines a buffer of the load cases and results decoded from a single punch file
+ *
+ */
+
+#ifndef PUNCH_BUFFER_H
+#define PUNCH_BUFFER_H
+
+#include "LOAD_CASE.h"
+#include "Punch_Index.h"
+#include "OP2_Reader.h"
+
+#include <string>
+#include <vector>
+#include <map>
+#include <cstddef>
+
+class Punch_Queue;
+
+//	A decoded CQUAD force result: Nx, Ny, Nxy, Mx, My, Mxy, Vx, Vy
+class Punch_CQUAD_Result
+{
+	public:
+		unsigned long elementID;
+		unsigned long subcaseID;
+		bool in_mat;
+		double values[8];
+};
+
+//	A decoded CBUSH force result: Fx, Fy, Fz, Mx, My, Mz
+class Punch_CBUSH_Result
+{
+	public:
+		unsigned long elementID;
+		unsigned long subcaseID;
+		double values[6];
+};
+
+//	A decoded CQUAD ply stress result: S1, S2, S12, S1Z, S2Z, Angle, Major, Minor, Max Shear
+class Punch_Ply_Result
+{
+	public:
+		unsigned long elementID;
+		unsigned long subcaseID;
+		unsigned int ply;
+		double values[9];
+};
+
+class Punch_Buffer
+{
+	public:
+		Punch_Buffer();
+
+		//	Constructor setting the punch file the buffer is filled from
+		Punch_Buffer(std::string FileName);
+
+		//	Deletes any load cases still held by the buffer and its chunk buffers
+		~Punch_Buffer();
+
+		std::string fileName;									///< Path of the punch file
+		bool opened;											///< Flags whether the file was opened
+		bool resultTypes[4];									///< Flags QUAD4 results in material axis, QUAD4 results in element axis, BUSH and QUAD4 ply results found
+		unsigned long subcaseID;								///< Subcase of the results being read
+		std::vector<Punch_Buffer*> chunks;						///< Buffers for the later byte ranges of a large file, in file order
+		bool indexing;											///< Flags whether the blocks decoded are recorded in index
+		Punch_Index index;										///< Key of the punch file and the blocks decoded into this buffer
+		bool listing;											///< Flags whether only the load cases are read, no results are decoded
+		OP2_Index op2Index;										///< Size of an OP2 file and the ident records of each subcase, recorded when listing
+		unsigned long streamSubcase;							///< Only subcase decoded when reading one subcase at a time, 0 for every subcase
+		Punch_Queue* decoded;									///< Queue the buffer is passed to once decoded, NULL if merged after every file is decoded
+		std::size_t sequence;									///< Position of the buffer in the order buffers are stored from the queue
+		Punch_Buffer* nextFile;									///< File buffer queued for decoding once the ranges of this file are queued, NULL for the last file
+		unsigned long long readBytes;							///< Bytes of the file read, set on the file buffer
+		double readSeconds;										///< Time spent opening and hashing the file, set on the file buffer
+		double decodeSeconds;									///< Time spent decoding the results of the buffer
+
+		//	Load cases in the file, each keeps the titles of its first header in the file
+		std::map<unsigned long, LOAD_CASE*> LOAD_CASE_Map;
+
+		//	Results in the order they appear in the file
+		std::vector<Punch_CQUAD_Result> CQUAD_Results;
+		std::vector<Punch_CBUSH_Result> CBUSH_Results;
+		std::vector<Punch_Ply_Result> Ply_Results;
+
+	private:
+		Punch_Buffer(const Punch_Buffer&);
+		Punch_Buffer& operator=(const Punch_Buffer&);
+};
+
+#endif // PUNCH_BUFFER_H
@@ -0,0 +1,70 @@
+/**
+ *
+ * @file		Punch_Filter.h
+ * @author		Matt Guimarey
+ * @date		17/10/2026
+ * @version		1.0
+ *
+ * This class defines the CQUADs, CBUSHes and subcases whose punch file results are kept
+ *
+ */
+
+#ifndef PUNCH_FILTER_H
+#define PUNCH_FILTER_H
+
+#include <vector>
+
+class Punch_Filter
+{
+	public:
+		//	Constructor for an empty filter, every result is kept
+		Punch_Filter();
+
+		~Punch_Filter();
+
+		//	Adds an ID to the selection, a type with no IDs added keeps every ID
+		void add_CQUAD(unsigned long ElementID);
+		void add_CBUSH(unsigned long ElementID);
+		void add_subcase(unsigned long SubcaseID);
+
+		//	Returns true if no IDs have been added
+		bool is_empty() const;
+
+		//	Return true if results for the ID are kept, safe to call from several threads
+		bool has_CQUAD(unsigned long ElementID) const { return has(0, ElementID); }
+		bool has_CBUSH(unsigned long ElementID) const { return has(1, ElementID); }
+		bool has_subcase(unsigned long SubcaseID) const { return has(2, SubcaseID); }
+
+		//	Return true if results for any ID from FirstID to LastID are kept
+		bool has_CQUAD_range(unsigned long FirstID, unsigned long LastID) const;
+		bool has_CBUSH_range(unsigned long FirstID, unsigned long LastID) const;
+
+		//	Number of IDs selected, 0 if every ID is kept
+		unsigned long CQUAD_size() const;
+		unsigned long CBUSH_size() const;
+
+	private:
+		/*	Bitmaps of the selected IDs indexed by type: 0 -> CQUAD, 1 -> CBUSH, 2 -> subcase. Bit n of a bitmap
+			is ID pBase + n, the bitmap only spans the lowest to the highest ID added */
+		std::vector<unsigned long long> pBits[3];
+		unsigned long pBase[3];			///< ID of the first bit of each bitmap, a multiple of 64
+		unsigned long pCount[3];		///< Number of IDs selected of each type
+		bool pSelected[3];				///< Flags whether any ID of each type has been added
+
+		void add(int type, unsigned long ID);
+		bool has_range(int type, unsigned long FirstID, unsigned long LastID) const;
+
+		bool has(int type, unsigned long ID) const
+		{
+			if (!pSelected[type]) {
+				return true;
+			}
+			if (ID < pBase[type]) {
+				return false;
+			}
+			unsigned long bit = ID - pBase[type];
+			return (bit >> 6) < pBits[type].size() && (pBits[type][bit >> 6] & (1ull << (bit & 63))) != 0;
+		}
+};
+
+#endif // PUNCH_FILTER_H
@@ -0,0 +1,62 @@
+/**
+ *
+ * @file		Punch_Index.h
+ * @author		Matt Guimarey
+ * @date		17/10/2026
+ * @version		1.0
+ *
+ * This class defines the sidecar index of the subcase blocks and result entries of a punch file
+ *
+ */
+
+#ifndef PUNCH_INDEX_H
+#define PUNCH_INDEX_H
+
+#include <string>
+#include <vector>
+
+//	A run of consecutive result entries of a subcase block
+class Punch_Segment
+{
+	public:
+		unsigned long long offset;		///< Byte offset of the first entry from the start of the block
+		unsigned long minID;			///< Lowest element ID in the run
+		unsigned long maxID;			///< Highest element ID in the run
+};
+
+//	A subcase block of a punch file, from its $TITLE line to the next
+class Punch_Block
+{
+	public:
+		Punch_Block();
+
+		//	Adds a result entry at a byte offset from the block start, a new segment is started every PUNCH_SEGMENT_SIZE entries
+		void add_entry(unsigned long long Offset, unsigned long ElementID);
+
+		unsigned long long offset;				///< Byte offset of the $TITLE line in the file
+		unsigned long long length;				///< Bytes in the block
+		unsigned long long entriesEnd;			///< Byte offset from the block start of the end of the last result entry
+		unsigned long subcaseID;				///< Subcase ID read from the block header
+		unsigned long entryCount;				///< Number of result entries in the block
+		std::vector<Punch_Segment> segments;	///< Result entries in runs, in file order
+};
+
+class Punch_Index
+{
+	public:
+		Punch_Index();
+
+		~Punch_Index();
+
+		/*	Write and read the index file. Returns false if the file could not be written, or does not exist
+			or is not an index file of this version */
+		bool save(std::string fileName);
+		bool load(std::string fileName);
+
+		unsigned long long size;				///< Size of the punch file in bytes
+		long long modified;						///< Modification time of the punch file
+		unsigned long long hash;				///< Hash of the punch file content
+		std::vector<Punch_Block> blocks;		///< Subcase blocks in file order
+};
+
+#endif // PUNCH_INDEX_H
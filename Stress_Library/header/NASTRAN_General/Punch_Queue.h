@@ -0,0 +1,48 @@
+/**
+ *
+ * @file		Punch_Queue.h
+ * @author		Matt Guimarey
+ * @date		17/10/2026
+ * @version		1.0
+ *
+ * This class defines a bounded reorder queue passing decoded punch buffers between threads in the order they are stored
+ *
+ */
+
+#ifndef PUNCH_QUEUE_H
+#define PUNCH_QUEUE_H
+
+#include <vector>
+#include <mutex>
+#include <condition_variable>
+#include <cstddef>
+
+class Punch_Buffer;
+
+class Punch_Queue
+{
+	public:
+		//	Constructor for a queue holding up to Capacity buffers
+		Punch_Queue(std::size_t Capacity);
+
+		~Punch_Queue();
+
+		/*	Add a buffer at the slot of its sequence number, the calling thread waits while the sequence is a whole
+			queue or more ahead of the next buffer to be removed. Any number of threads may push at once */
+		void push(Punch_Buffer* buffer);
+
+		//	Remove the buffer with the next sequence number, the calling thread waits until it has been added
+		Punch_Buffer* pop();
+
+	private:
+		std::vector<Punch_Buffer*> pSlots;			///< Ring of slots, a buffer is held at its sequence number modulo the capacity
+		std::size_t pHead;							///< Sequence number of the next pop
+		std::mutex pMutex;							///< Guards the slots and head
+		std::condition_variable pAdded;				///< Signals the consumer that a buffer was added
+		std::condition_variable pRemoved;			///< Signals producers that the head has moved
+
+		Punch_Queue(const Punch_Queue&);
+		Punch_Queue& operator=(const Punch_Queue&);
+};
+
+#endif // PUNCH_QUEUE_H
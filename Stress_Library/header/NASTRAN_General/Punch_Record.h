@@ -0,0 +1,40 @@
+/**
+ *
+ * @file		Punch_Record.h
+ * @author		Matt Guimarey
+ * @date		17/10/2026
+ * @version		1.0
+ *
+ * This class decodes the result fields of a punch file result entry
+ *
+ */
+
+#ifndef PUNCH_RECORD_H
+#define PUNCH_RECORD_H
+
+#include "BDF_Line.h"
+
+#include <cstddef>
+
+class Punch_Record
+{
+	public:
+		//	Constructor setting the lines of the entry, no characters are copied
+		Punch_Record(const BDF_Line* Lines, int LineCount);
+
+		~Punch_Record();
+
+		/*	Decodes the first count result fields of the entry, three 18 column fields from column 19 of each
+			line. Fields past the end of a line are 0.0 */
+		void decode(double* values, int count) const;
+
+	private:
+		const BDF_Line* pLines;		///< Lines of the entry
+		int pLineCount;				///< Number of lines of the entry
+
+		/*	Decodes a field of length columns written as NASTRAN punches reals, [-]d.ddddddE[+|-]dd left
+			aligned, returns false for any other field */
+		static bool decode_field(const char* field, std::size_t length, double &value);
+};
+
+#endif // PUNCH_RECORD_H
@@ -0,0 +1,38 @@
+/**
+ *
+ * @file		Punch_Stream.h
+ * @author		Matt Guimarey
+ * @date		17/10/2026
+ * @version		1.0
+ *
+ * This class defines a set of results files opened to be read one subcase at a time
+ *
+ */
+
+#ifndef PUNCH_STREAM_H
+#define PUNCH_STREAM_H
+
+#include "Punch_Index.h"
+#include "OP2_Reader.h"
+
+#include <string>
+#include <vector>
+#include <memory>
+
+class Punch_Stream
+{
+	public:
+		Punch_Stream();
+
+		~Punch_Stream();
+
+		//	Removes all files and subcases
+		void clear();
+
+		std::vector<std::string> fileNames;							///< Paths of the results files in the order given
+		std::vector<std::shared_ptr<Punch_Index> > indexes;			///< Index of each punch file, NULL for OP2 files and files not opened
+		std::vector<std::shared_ptr<OP2_Index> > op2Indexes;		///< Index of each OP2 file, NULL for punch files and files not opened
+		std::vector<unsigned long> subcases;						///< Subcases kept by the punch filter found in any of the files, in ascending order
+};
+
+#endif // PUNCH_STREAM_H
@@ -13,6 +13,9 @@
 #define RBE2_H
 
 #include "GRID.h"
+#include "BDF_Line.h"
+#include "IO/Binary_Writer.h"
+#include "IO/Binary_Reader.h"
 
 #include <vector>
 #include <string>
@@ -24,12 +27,12 @@ class RBE2
 		RBE2();
 
 		// 	Constructor parsing bdf data
-		RBE2(std::vector<std::string> BDF_Data, bool LongFormatFlag);
+		RBE2(std::vector<BDF_Line> &BDF_Data, bool LongFormatFlag);
 
 		~RBE2();
 
 		// 	Parses BDF data based off a standard bulk data file, can set short or long format
-		void parseBDFData(std::vector<std::string> BDF_Data, bool LongFormatFlag);
+		void parseBDFData(std::vector<BDF_Line> &BDF_Data, bool LongFormatFlag);
 
 		//	Get number of dependant nodes
 		int get_num_dependant_nodes();	
@@ -44,14 +47,14 @@ class RBE2
 			Node ID, 2 -> DOF, 3... -> Dependant Nodes */
 		unsigned long operator[](unsigned int i);
 
+		//	Write and read the class data in a binary model snapshot
+		void writeSnapshot(Binary_Writer &writer);
+		void readSnapshot(Binary_Reader &reader);
+
 	private:
 		unsigned long pLongData[3];						///< unsigned long data array storing class data (RBE_ID, Ind Node, DOF)
 		std::vector<unsigned long> pDependantNodes;		///< unsigned long vector containing list of dependant nodes
 		double pThermal;								///< double for thermal expansion coefficient
-
-
-		std::string check_exp(std::string &str);
-		bool checkReal(std::string &str);
 };
 
 #endif // RBE2_H
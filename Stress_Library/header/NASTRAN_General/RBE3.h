@@ -13,6 +13,9 @@
 #define RBE3_H
 
 #include "GRID.h"
+#include "BDF_Line.h"
+#include "IO/Binary_Writer.h"
+#include "IO/Binary_Reader.h"
 
 #include <vector>
 #include <string>
@@ -24,12 +27,12 @@ class RBE3
 		RBE3();
 
 		// 	Constructor parsing bdf data
-		RBE3(std::vector<std::string> BDF_Data, bool LongFormatFlag);
+		RBE3(std::vector<BDF_Line> &BDF_Data, bool LongFormatFlag);
 
 		~RBE3();
 
 		// 	Parses BDF data based off a standard bulk data file, can set short or long format
-		void parseBDFData(std::vector<std::string> BDF_Data, bool LongFormatFlag);
+		void parseBDFData(std::vector<BDF_Line> &BDF_Data, bool LongFormatFlag);
 
 		//	Get number of dependant nodes
 		int get_num_independant_nodes();	
@@ -44,16 +47,16 @@ class RBE3
 			Node ID, 2 -> DOF, 3... -> Independent Nodes */
 		unsigned long operator[](unsigned int i);
 
+		//	Write and read the class data in a binary model snapshot
+		void writeSnapshot(Binary_Writer &writer);
+		void readSnapshot(Binary_Reader &reader);
+
 	private:
 		unsigned long pLongData[3];	///< unsigned long data array storing class data (RBE_ID, Dep Node, REFC)
 		std::vector<unsigned long> pIndependantNodes;	///< vector of independent node vectors
 		std::vector<unsigned long> pDOFs;	///< vector of DOFs
 		std::vector<double> pWeightingFactors;	///< vector of weighting factors
 		double pThermal;	///< double for thermal expansion coefficient
-
-
-		std::string check_exp(std::string &str);
-		bool checkReal(std::string &str);
 };
 
 #endif // RBE3_H
@@ -0,0 +1,59 @@
+/**
+ *
+ * @file		Result_Store.h
+ * @author		Matt Guimarey
+ * @date		17/10/2026
+ * @version		1.0
+ *
+ * This class stores the punch file results of one element type in dense arrays
+ *
+ */
+
+#ifndef RESULT_STORE_H
+#define RESULT_STORE_H
+
+#include <vector>
+#include <map>
+
+class Result_Store
+{
+	public:
+		Result_Store();
+
+		//	Constructor for a store holding Components result values per element and subcase
+		Result_Store(int Components);
+
+		~Result_Store();
+
+		//	Returns the dense index of a new element, elements are numbered in the order they are added
+		unsigned long add_element();
+
+		/*	Adds the result values of an element for a subcase with a flag stored alongside them. The first
+			result added for an element and subcase is kept */
+		void add_result(unsigned long Index, unsigned long SubcaseID, const double* values, bool flag);
+
+		/*	Returns the result values of an element for a subcase and sets flag to the flag stored with them,
+			NULL if no result was added */
+		const double* get_result(unsigned long Index, unsigned long SubcaseID, bool &flag) const;
+
+		//	Number of elements and subcases in the store
+		unsigned long element_count() const;
+		unsigned long subcase_count() const;
+
+		//	Removes all elements and results, the number of components is kept
+		void clear();
+
+		//	Removes the results of every subcase, elements keep their indices
+		void clear_results();
+
+	private:
+		int pComponents;												///< Number of result values per element and subcase
+		unsigned long pElements;										///< Number of element indices handed out
+		std::map<unsigned long, unsigned long> pSubcaseIndex;			///< Dense index of each subcase ID
+		/*	Result values and flags by subcase index, laid out [element][component] and sized up to the last
+			element with a result. Flags are 0 -> no result, 1 -> result, 2 -> result with flag set */
+		std::vector<std::vector<double> > pValues;
+		std::vector<std::vector<unsigned char> > pFlags;
+};
+
+#endif // RESULT_STORE_H
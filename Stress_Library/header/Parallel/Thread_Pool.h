@@ -0,0 +1,59 @@
+/**
+ *
+ * @file		Thread_Pool.h
+ * @author		Matt Guimarey
+ * @date		17/10/2026
+ * @version		1.0
+ *
+ * This class defines a fixed size pool of worker threads fed from a task queue
+ *
+ */
+
+#ifndef THREAD_POOL_H
+#define THREAD_POOL_H
+
+#include <vector>
+#include <deque>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+
+class Thread_Pool
+{
+	public:
+		//	Constructor starting one worker per hardware thread
+		Thread_Pool();
+
+		//	Constructor starting a set number of workers (0 -> one per hardware thread)
+		Thread_Pool(unsigned int threadCount);
+
+		//	Waits for all queued tasks to complete and joins the workers
+		~Thread_Pool();
+
+		//	Queue a task, tasks may queue further tasks while running
+		void add_task(std::function<void()> task);
+
+		//	Blocks until the queue is empty and no task is running
+		void wait();
+
+		//	Number of worker threads
+		unsigned int size();
+
+	private:
+		std::vector<std::thread> pWorkers;				///< Worker threads
+		std::deque<std::function<void()> > pTasks;		///< Queue of tasks waiting for a worker
+		std::mutex pMutex;								///< Guards the task queue and counters
+		std::condition_variable pTaskReady;				///< Signals workers that a task was queued or the pool is stopping
+		std::condition_variable pTasksDone;				///< Signals wait() that the pool has gone idle
+		unsigned int pActive;							///< Number of tasks currently running
+		bool pStop;										///< Flags the workers to exit once the queue is empty
+
+		void start(unsigned int threadCount);
+		void run_worker();
+
+		Thread_Pool(const Thread_Pool&);
+		Thread_Pool& operator=(const Thread_Pool&);
+};
+
+#endif // THREAD_POOL_H
@@ -0,0 +1,126 @@
+/**
+ *
+ * @file		Binary_Reader.cpp
+ * @author		Matt Guimarey
+ * @date		17/10/2026
+ * @version		1.0
+ *
+ * This class defines a reader of binary data files written by Binary_Writer
+ *
+ */
+
+#include "IO/Binary_Reader.h"
+#include "IO/Mapped_File.h"
+
+#include <string>
+#include <vector>
+#include <cstring>
+
+Binary_Reader::Binary_Reader()
+{
+	pCursor = NULL;
+	pGood = false;
+}
+
+Binary_Reader::~Binary_Reader()
+{
+
+}
+
+bool Binary_Reader::open(std::string fileName)
+{
+	pGood = pFile.open(fileName);
+	pCursor = pFile.begin();
+	return pGood;
+}
+
+unsigned long long Binary_Reader::read_ulong()
+{
+	unsigned long long value = 0;
+	const char* data = take(sizeof(value));
+	if (data != NULL) {
+		std::memcpy(&value, data, sizeof(value));
+	}
+	return value;
+}
+
+double Binary_Reader::read_double()
+{
+	double value = 0.0;
+	const char* data = take(sizeof(value));
+	if (data != NULL) {
+		std::memcpy(&value, data, sizeof(value));
+	}
+	return value;
+}
+
+bool Binary_Reader::read_bool()
+{
+	const char* data = take(1);
+	return data != NULL && *data != 0;
+}
+
+std::string Binary_Reader::read_string()
+{
+	std::size_t size = read_ulong();
+	const char* data = take(size);
+	if (data == NULL) {
+		return "";
+	}
+	return std::string(data, size);
+}
+
+void Binary_Reader::read_ulongs(std::vector<unsigned long> &Values)
+{
+	std::size_t size = read_ulong();
+	Values.clear();
+	// Check the whole vector is inside the file before allocating
+	if (size > (std::size_t)(pFile.end() - pCursor) / sizeof(unsigned long long)) {
+		pGood = false;
+		return;
+	}
+	Values.resize(size);
+	for (std::size_t i = 0; i < size; i++) {
+		Values[i] = read_ulong();
+	}
+}
+
+void Binary_Reader::read_doubles(std::vector<double> &Values)
+{
+	std::size_t size = read_ulong();
+	Values.clear();
+	if (size > (std::size_t)(pFile.end() - pCursor) / sizeof(double)) {
+		pGood = false;
+		return;
+	}
+	Values.resize(size);
+	if (size > 0) {
+		std::memcpy(&Values[0], take(size * sizeof(double)), size * sizeof(double));
+	}
+}
+
+bool Binary_Reader::good()
+{
+	return pGood;
+}
+
+bool Binary_Reader::at_end()
+{
+	return pCursor == pFile.end();
+}
+
+std::size_t Binary_Reader::remaining()
+{
+	return pCursor != NULL ? (std::size_t)(pFile.end() - pCursor) : 0;
+}
+
+const char* Binary_Reader::take(std::size_t Size)
+{
+	if (!pGood || Size > (std::size_t)(pFile.end() - pCursor)) {
+		pGood = false;
+		return NULL;
+	}
+	const char* data = pCursor;
+	pCursor += Size;
+	return data;
+}
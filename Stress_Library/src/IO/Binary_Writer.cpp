@@ -0,0 +1,113 @@
+/**
+ *
+ * @file		Binary_Writer.cpp
+ * @author		Matt Guimarey
+ * @date		17/10/2026
+ * @version		1.0
+ *
+ * This class defines a buffered writer of binary data files
+ *
+ */
+
+#include "IO/Binary_Writer.h"
+
+#include <string>
+#include <vector>
+#include <fstream>
+#include <cstdio>
+#include <cstring>
+#include <algorithm>
+
+#define BUFFER_STEP 65536	// Minimum bytes the buffer grows by
+
+Binary_Writer::Binary_Writer()
+{
+	pSize = 0;
+}
+
+Binary_Writer::~Binary_Writer()
+{
+
+}
+
+void Binary_Writer::write_ulong(unsigned long long Value)
+{
+	append(&Value, sizeof(Value));
+}
+
+void Binary_Writer::write_double(double Value)
+{
+	append(&Value, sizeof(Value));
+}
+
+void Binary_Writer::write_bool(bool Value)
+{
+	char byte = Value ? 1 : 0;
+	append(&byte, 1);
+}
+
+void Binary_Writer::write_string(const std::string &Value)
+{
+	write_ulong(Value.size());
+	append(Value.data(), Value.size());
+}
+
+void Binary_Writer::write_ulongs(const std::vector<unsigned long> &Values)
+{
+	write_ulong(Values.size());
+	for (int i = 0; i < Values.size(); i++) {
+		write_ulong(Values[i]);
+	}
+}
+
+void Binary_Writer::write_doubles(const std::vector<double> &Values)
+{
+	write_ulong(Values.size());
+	if (!Values.empty()) {
+		append(&Values[0], Values.size() * sizeof(double));
+	}
+}
+
+/**
+ *	@brief	Writes the buffer to a file. The data is written to fileName.tmp which then
+ *			replaces the file, a reader never sees a partly written file.
+ *
+ *	@param	fileName, a string with the path of the file to write
+ *	@return	bool, false if the file could not be written
+ */
+
+bool Binary_Writer::save(std::string fileName)
+{
+	std::string tempName = fileName + ".tmp";
+	std::fstream outFile;
+	outFile.open(tempName.c_str(), std::ios_base::out | std::ios_base::binary | std::ios_base::trunc);
+	if (!outFile.is_open()) {
+		return false;
+	}
+	if (pSize > 0) {
+		outFile.write(&pBuffer[0], pSize);
+	}
+	outFile.close();
+	if (outFile.fail()) {
+		std::remove(tempName.c_str());
+		return false;
+	}
+	// Windows will not rename over an existing file
+	std::remove(fileName.c_str());
+	return std::rename(tempName.c_str(), fileName.c_str()) == 0;
+}
+
+bool Binary_Writer::same(const Binary_Writer &other) const
+{
+	return pSize == other.pSize && (pSize == 0 || std::memcmp(&pBuffer[0], &other.pBuffer[0], pSize) == 0);
+}
+
+void Binary_Writer::append(const void* Data, std::size_t Size)
+{
+	// The buffer grows in large steps, most appends are a single copy
+	if (pSize + Size > pBuffer.size()) {
+		pBuffer.resize(std::max(2 * pBuffer.size(), pSize + Size + BUFFER_STEP));
+	}
+	std::memcpy(&pBuffer[pSize], Data, Size);
+	pSize += Size;
+}
@@ -0,0 +1,542 @@
+/**
+ *
+ * @file		Gzip_Inflater.cpp
+ * @author		Matt Guimarey
+ * @date		17/10/2026
+ * @version		1.0
+ *
+ * This class defines a decompressor of gzip (RFC 1952) data held in memory
+ *
+ */
+
+#include "IO/Gzip_Inflater.h"
+
+#include <vector>
+#include <cstring>
+
+#define INFLATE_FAST_BITS 10		// Codes up to this length are decoded with a single table lookup
+#define INFLATE_MAX_BITS 15			// Longest deflate code
+#define INFLATE_MAX_SYMBOLS 288		// Literal/length codes, the largest deflate alphabet
+
+//	Canonical Huffman code of a deflate block
+class Huffman_Table
+{
+	public:
+		unsigned short fast[1 << INFLATE_FAST_BITS];	///< Symbol << 4 | length indexed by the next bits, 0 for longer codes
+		unsigned short count[INFLATE_MAX_BITS + 1];		///< Number of codes of each length
+		unsigned short symbols[INFLATE_MAX_SYMBOLS];	///< Symbols in code order
+};
+
+static bool buildTable(Huffman_Table &table, const unsigned char* lengths, int symbolCount);
+
+//	Codes of fixed Huffman deflate blocks, built once on first use
+class Fixed_Tables
+{
+	public:
+		Fixed_Tables()
+		{
+			unsigned char codeLengths[INFLATE_MAX_SYMBOLS];
+			for (int i = 0; i < INFLATE_MAX_SYMBOLS; i++) {
+				codeLengths[i] = i < 144 ? 8 : i < 256 ? 9 : i < 280 ? 7 : 8;
+			}
+			buildTable(lengths, codeLengths, INFLATE_MAX_SYMBOLS);
+			memset(codeLengths, 5, 30);
+			buildTable(distances, codeLengths, 30);
+		}
+
+		Huffman_Table lengths;		///< Literal/length code
+		Huffman_Table distances;	///< Distance code
+};
+
+//	CRC-32 lookup tables for four bytes at a time, built once on first use
+class Crc_Table
+{
+	public:
+		Crc_Table()
+		{
+			for (unsigned int i = 0; i < 256; i++) {
+				unsigned int value = i;
+				for (int bit = 0; bit < 8; bit++) {
+					value = value & 1 ? 0xEDB88320u ^ (value >> 1) : value >> 1;
+				}
+				values[0][i] = value;
+			}
+			for (unsigned int i = 0; i < 256; i++) {
+				for (int j = 1; j < 4; j++) {
+					values[j][i] = (values[j - 1][i] >> 8) ^ values[0][values[j - 1][i] & 0xFF];
+				}
+			}
+		}
+
+		unsigned int values[4][256];	///< CRC of byte i shifted through j further bytes
+};
+
+//	Base values and extra bits of the length (257 -> 285) and distance (0 -> 29) symbols
+static const unsigned short lengthBase[29] = {3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31,
+	35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258};
+static const unsigned char lengthExtra[29] = {0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2,
+	3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0};
+static const unsigned short distanceBase[30] = {1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193,
+	257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577};
+static const unsigned char distanceExtra[30] = {0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6,
+	7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13};
+
+/**
+ *	@brief	Builds the decoding table of a canonical Huffman code from its code lengths.
+ *			Deflate stores codes from their most significant bit, so each code is bit
+ *			reversed before it is entered in the fast lookup table.
+ *
+ *	@param	table, the table to build
+ *	@param	lengths, the code length of each symbol, 0 for unused symbols
+ *	@param	symbolCount, the number of symbols
+ *	@return	bool, false if the lengths are over-subscribed
+ */
+
+static bool buildTable(Huffman_Table &table, const unsigned char* lengths, int symbolCount)
+{
+	memset(table.count, 0, sizeof(table.count));
+	memset(table.fast, 0, sizeof(table.fast));
+	for (int i = 0; i < symbolCount; i++) {
+		table.count[lengths[i]]++;
+	}
+	table.count[0] = 0;
+	int left = 1;
+	unsigned short offsets[INFLATE_MAX_BITS + 1];
+	offsets[1] = 0;
+	for (int length = 1; length <= INFLATE_MAX_BITS; length++) {
+		left = (left << 1) - table.count[length];
+		if (left < 0) {
+			return false;
+		}
+		if (length < INFLATE_MAX_BITS) {
+			offsets[length + 1] = offsets[length] + table.count[length];
+		}
+	}
+	for (int i = 0; i < symbolCount; i++) {
+		if (lengths[i] != 0) {
+			table.symbols[offsets[lengths[i]]++] = (unsigned short)i;
+		}
+	}
+	// Fast table entries for every code short enough, in canonical code order
+	int code = 0, index = 0;
+	for (int length = 1; length <= INFLATE_FAST_BITS; length++) {
+		for (int i = 0; i < table.count[length]; i++, code++, index++) {
+			int reversed = 0;
+			for (int bit = 0; bit < length; bit++) {
+				reversed |= ((code >> bit) & 1) << (length - 1 - bit);
+			}
+			unsigned short entry = (unsigned short)(table.symbols[index] << 4 | length);
+			for (int j = reversed; j < (1 << INFLATE_FAST_BITS); j += 1 << length) {
+				table.fast[j] = entry;
+			}
+		}
+		code <<= 1;
+	}
+	return true;
+}
+
+/**
+ *	@brief	Returns the CRC-32 (ISO 3309) of a block of bytes continuing from a previous CRC.
+ *
+ *	@param	crc, the CRC of the bytes before the block, 0 for the first block
+ *	@param	data, a pointer to the bytes
+ *	@param	size, the number of bytes
+ *	@return	unsigned int, the CRC of the bytes so far
+ */
+
+static unsigned int crc32(unsigned int crc, const unsigned char* data, std::size_t size)
+{
+	static const Crc_Table crcTable;
+	const unsigned int (*table)[256] = crcTable.values;
+	crc = ~crc;
+	// Four bytes per step, then the bytes left over one at a time
+	for (; size >= 4; size -= 4, data += 4) {
+		crc ^= (unsigned int)data[0] | (unsigned int)data[1] << 8 | (unsigned int)data[2] << 16 | (unsigned int)data[3] << 24;
+		crc = table[3][crc & 0xFF] ^ table[2][(crc >> 8) & 0xFF] ^ table[1][(crc >> 16) & 0xFF] ^ table[0][crc >> 24];
+	}
+	for (; size > 0; size--, data++) {
+		crc = table[0][(crc ^ *data) & 0xFF] ^ (crc >> 8);
+	}
+	return ~crc;
+}
+
+Gzip_Inflater::Gzip_Inflater(const char* Begin, const char* End)
+{
+	pPosition = (const unsigned char*)Begin;
+	pEnd = (const unsigned char*)End;
+	pBits = 0;
+	pBitCount = 0;
+	pOutput = NULL;
+	pSize = 0;
+}
+
+Gzip_Inflater::~Gzip_Inflater()
+{
+
+}
+
+bool Gzip_Inflater::is_gzip(const char* begin, const char* end)
+{
+	return end - begin >= 2 && (unsigned char)begin[0] == 0x1F && (unsigned char)begin[1] == 0x8B;
+}
+
+/**
+ *	@brief	Decompresses the gzip members of the data one after another. The output is sized
+ *			from the uncompressed size recorded in the last member's trailer and grown if the
+ *			data holds more. Anything after the last member that is not another member is
+ *			ignored, as gzip ignores trailing padding.
+ *
+ *	@param	output, a char vector receiving the decompressed bytes
+ *	@return	bool, false if the data is not gzip, is corrupt or is truncated
+ */
+
+bool Gzip_Inflater::inflate(std::vector<char> &output)
+{
+	output.clear();
+	pOutput = &output;
+	pSize = 0;
+	if (!is_gzip((const char*)pPosition, (const char*)pEnd)) {
+		return false;
+	}
+	// Deflate expands data at most 1032 times, a larger size is trailing padding and not a trailer
+	if (pEnd - pPosition >= 4) {
+		const unsigned char* trailer = pEnd - 4;
+		std::size_t expected = (std::size_t)trailer[0] | (std::size_t)trailer[1] << 8 | (std::size_t)trailer[2] << 16 | (std::size_t)trailer[3] << 24;
+		if (expected / 1032 <= (std::size_t)(pEnd - pPosition)) {
+			output.resize(expected);
+		}
+	}
+	bool good = true;
+	while (good && is_gzip((const char*)pPosition, (const char*)pEnd)) {
+		good = read_member();
+	}
+	output.resize(good ? pSize : 0);
+	pOutput = NULL;
+	return good;
+}
+
+/**
+ *	@brief	Decompresses one gzip member. The header's optional extra, name, comment and
+ *			header CRC fields are skipped, the deflate blocks are decompressed and the CRC and
+ *			size in the trailer are checked against the bytes written.
+ *
+ *	@return	bool, false if the member is corrupt or truncated
+ */
+
+bool Gzip_Inflater::read_member()
+{
+	std::size_t memberStart = pSize;
+	if (pEnd - pPosition < 10 || pPosition[2] != 8) {
+		return false;
+	}
+	unsigned char flags = pPosition[3];
+	pPosition += 10;
+	if (flags & 4) {
+		// FEXTRA
+		if (pEnd - pPosition < 2) {
+			return false;
+		}
+		std::size_t extra = (std::size_t)pPosition[0] | (std::size_t)pPosition[1] << 8;
+		pPosition += 2;
+		if ((std::size_t)(pEnd - pPosition) < extra) {
+			return false;
+		}
+		pPosition += extra;
+	}
+	for (int field = 8; field <= 16; field <<= 1) {
+		// FNAME and FCOMMENT, zero terminated
+		if (flags & field) {
+			const unsigned char* terminator = (const unsigned char*)memchr(pPosition, 0, pEnd - pPosition);
+			if (terminator == NULL) {
+				return false;
+			}
+			pPosition = terminator + 1;
+		}
+	}
+	if (flags & 2) {
+		// FHCRC
+		pPosition += 2;
+		if (pPosition > pEnd) {
+			return false;
+		}
+	}
+	pBits = 0;
+	pBitCount = 0;
+	unsigned int final = 0;
+	while (final == 0) {
+		unsigned int type;
+		if (!get_bits(1, final) || !get_bits(2, type)) {
+			return false;
+		}
+		bool good = false;
+		if (type == 0) {
+			good = copy_stored();
+		} else if (type == 1) {
+			static const Fixed_Tables fixed;
+			good = inflate_block(fixed.lengths, fixed.distances);
+		} else if (type == 2) {
+			good = inflate_dynamic();
+		}
+		if (!good) {
+			return false;
+		}
+	}
+	align_input();
+	if (pEnd - pPosition < 8) {
+		return false;
+	}
+	unsigned int crc = (unsigned int)pPosition[0] | (unsigned int)pPosition[1] << 8 | (unsigned int)pPosition[2] << 16 | (unsigned int)pPosition[3] << 24;
+	unsigned int size = (unsigned int)pPosition[4] | (unsigned int)pPosition[5] << 8 | (unsigned int)pPosition[6] << 16 | (unsigned int)pPosition[7] << 24;
+	pPosition += 8;
+	std::size_t written = pSize - memberStart;
+	return size == (unsigned int)written && crc == crc32(0, (const unsigned char*)pOutput->data() + memberStart, written);
+}
+
+/**
+ *	@brief	Copies a stored (uncompressed) deflate block to the output.
+ *
+ *	@return	bool, false if the block length is corrupt or the data ends inside the block
+ */
+
+bool Gzip_Inflater::copy_stored()
+{
+	align_input();
+	if (pEnd - pPosition < 4) {
+		return false;
+	}
+	std::size_t length = (std::size_t)pPosition[0] | (std::size_t)pPosition[1] << 8;
+	std::size_t check = (std::size_t)pPosition[2] | (std::size_t)pPosition[3] << 8;
+	pPosition += 4;
+	if ((length ^ 0xFFFF) != check || (std::size_t)(pEnd - pPosition) < length) {
+		return false;
+	}
+	if (length == 0) {
+		return true;
+	}
+	reserve(length);
+	memcpy(&(*pOutput)[0] + pSize, pPosition, length);
+	pSize += length;
+	pPosition += length;
+	return true;
+}
+
+/**
+ *	@brief	Decompresses the symbols of a Huffman coded deflate block until the end of block
+ *			symbol. Matches may overlap the bytes they copy, those are copied a byte at a
+ *			time.
+ *
+ *	@param	lengths, the literal/length code of the block
+ *	@param	distances, the distance code of the block
+ *	@return	bool, false if a code or match distance is invalid or the data ends first
+ */
+
+bool Gzip_Inflater::inflate_block(const Huffman_Table &lengths, const Huffman_Table &distances)
+{
+	while (true) {
+		int symbol = decode(lengths);
+		if (symbol < 0) {
+			return false;
+		}
+		if (symbol < 256) {
+			reserve(1);
+			(*pOutput)[pSize++] = (char)symbol;
+			continue;
+		}
+		if (symbol == 256) {
+			return true;
+		}
+		symbol -= 257;
+		if (symbol >= 29) {
+			return false;
+		}
+		unsigned int extra;
+		if (!get_bits(lengthExtra[symbol], extra)) {
+			return false;
+		}
+		std::size_t length = lengthBase[symbol] + extra;
+		symbol = decode(distances);
+		if (symbol < 0 || symbol >= 30 || !get_bits(distanceExtra[symbol], extra)) {
+			return false;
+		}
+		std::size_t distance = distanceBase[symbol] + extra;
+		if (distance > pSize) {
+			return false;
+		}
+		reserve(length);
+		char* target = &(*pOutput)[0] + pSize;
+		const char* source = target - distance;
+		if (distance >= length) {
+			memcpy(target, source, length);
+		} else {
+			for (std::size_t i = 0; i < length; i++) {
+				target[i] = source[i];
+			}
+		}
+		pSize += length;
+	}
+}
+
+/**
+ *	@brief	Reads the code lengths of a dynamic Huffman deflate block, themselves Huffman
+ *			coded with run lengths, then decompresses the block.
+ *
+ *	@return	bool, false if the code lengths are invalid or the block is corrupt
+ */
+
+bool Gzip_Inflater::inflate_dynamic()
+{
+	static const unsigned char order[19] = {16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2, 14, 1, 15};
+	unsigned int lengthCount, distanceCount, codeCount;
+	if (!get_bits(5, lengthCount) || !get_bits(5, distanceCount) || !get_bits(4, codeCount)) {
+		return false;
+	}
+	lengthCount += 257;
+	distanceCount += 1;
+	codeCount += 4;
+	if (lengthCount > 286 || distanceCount > 30) {
+		return false;
+	}
+	unsigned char lengths[INFLATE_MAX_SYMBOLS + 32];
+	memset(lengths, 0, 19);
+	for (unsigned int i = 0; i < codeCount; i++) {
+		unsigned int length;
+		if (!get_bits(3, length)) {
+			return false;
+		}
+		lengths[order[i]] = (unsigned char)length;
+	}
+	Huffman_Table lengthTable, distanceTable;
+	if (!buildTable(lengthTable, lengths, 19)) {
+		return false;
+	}
+	// Literal/length and distance code lengths run on as one sequence
+	unsigned int index = 0;
+	while (index < lengthCount + distanceCount) {
+		int symbol = decode(lengthTable);
+		if (symbol < 0) {
+			return false;
+		}
+		if (symbol < 16) {
+			lengths[index++] = (unsigned char)symbol;
+			continue;
+		}
+		unsigned int repeat;
+		unsigned char value = 0;
+		if (symbol == 16) {
+			if (index == 0 || !get_bits(2, repeat)) {
+				return false;
+			}
+			value = lengths[index - 1];
+			repeat += 3;
+		} else if (symbol == 17) {
+			if (!get_bits(3, repeat)) {
+				return false;
+			}
+			repeat += 3;
+		} else {
+			if (!get_bits(7, repeat)) {
+				return false;
+			}
+			repeat += 11;
+		}
+		if (index + repeat > lengthCount + distanceCount) {
+			return false;
+		}
+		memset(lengths + index, value, repeat);
+		index += repeat;
+	}
+	if (lengths[256] == 0) {
+		return false;
+	}
+	if (!buildTable(lengthTable, lengths, lengthCount) || !buildTable(distanceTable, lengths + lengthCount, distanceCount)) {
+		return false;
+	}
+	return inflate_block(lengthTable, distanceTable);
+}
+
+/**
+ *	@brief	Loads whole bytes of compressed data into the bit buffer until it holds at least
+ *			56 bits or the data ends.
+ *
+ *	@return	void
+ */
+
+void Gzip_Inflater::refill()
+{
+	while (pBitCount <= 56 && pPosition < pEnd) {
+		pBits |= (unsigned long long)*pPosition++ << pBitCount;
+		pBitCount += 8;
+	}
+}
+
+bool Gzip_Inflater::get_bits(int count, unsigned int &value)
+{
+	if (pBitCount < count) {
+		refill();
+		if (pBitCount < count) {
+			return false;
+		}
+	}
+	value = (unsigned int)(pBits & ((1ull << count) - 1));
+	pBits >>= count;
+	pBitCount -= count;
+	return true;
+}
+
+/**
+ *	@brief	Decodes the next symbol of a Huffman code. Codes up to INFLATE_FAST_BITS long are
+ *			found with one table lookup, longer codes are decoded a bit at a time from the
+ *			code length counts.
+ *
+ *	@param	table, the code to decode with
+ *	@return	int, the symbol, -1 if the bits are not a code or the data ends first
+ */
+
+int Gzip_Inflater::decode(const Huffman_Table &table)
+{
+	if (pBitCount < INFLATE_MAX_BITS) {
+		refill();
+	}
+	unsigned short entry = table.fast[pBits & ((1 << INFLATE_FAST_BITS) - 1)];
+	if (entry != 0) {
+		int length = entry & 15;
+		if (length > pBitCount) {
+			return -1;
+		}
+		pBits >>= length;
+		pBitCount -= length;
+		return entry >> 4;
+	}
+	int code = 0, first = 0, index = 0;
+	for (int length = 1; length <= INFLATE_MAX_BITS && length <= pBitCount; length++) {
+		code |= (int)((pBits >> (length - 1)) & 1);
+		int count = table.count[length];
+		if (code - first < count) {
+			pBits >>= length;
+			pBitCount -= length;
+			return table.symbols[index + code - first];
+		}
+		index += count;
+		first = (first + count) << 1;
+		code <<= 1;
+	}
+	return -1;
+}
+
+void Gzip_Inflater::align_input()
+{
+	pBits = 0;
+	pPosition -= pBitCount >> 3;
+	pBitCount = 0;
+}
+
+void Gzip_Inflater::reserve(std::size_t count)
+{
+	if (pSize + count > pOutput->size()) {
+		std::size_t capacity = pOutput->size() * 2;
+		if (capacity < pSize + count) {
+			capacity = pSize + count + 65536;
+		}
+		pOutput->resize(capacity);
+	}
+}
@@ -0,0 +1,226 @@
+/**
+ *
+ * @file		Mapped_File.cpp
+ * @author		Matt Guimarey
+ * @date		17/10/2026
+ * @version		1.0
+ *
+ * This class defines a read-only memory mapped file, gzip files are decompressed into memory
+ *
+ */
+
+#include "IO/Mapped_File.h"
+#include "IO/Gzip_Inflater.h"
+
+#include <string>
+#include <vector>
+#include <cstring>
+#include <cstdint>
+#include <iostream>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+Mapped_File::Mapped_File()
+{
+	pData = NULL;
+	pSize = 0;
+	pOpen = false;
+#ifdef _WIN32
+	pFileHandle = INVALID_HANDLE_VALUE;
+	pMapHandle = NULL;
+#else
+	pFileHandle = -1;
+#endif
+}
+
+Mapped_File::Mapped_File(std::string fileName)
+{
+	pData = NULL;
+	pSize = 0;
+	pOpen = false;
+#ifdef _WIN32
+	pFileHandle = INVALID_HANDLE_VALUE;
+	pMapHandle = NULL;
+#else
+	pFileHandle = -1;
+#endif
+	open(fileName);
+}
+
+Mapped_File::~Mapped_File()
+{
+	close();
+}
+
+/**
+ *	@brief	Maps a file into memory as a read-only view. Any previously mapped file is
+ *			released first. The operating system pages the file in on demand, so no
+ *			copy of the file contents is made, except for a gzip file which is decompressed
+ *			into memory. The whole file is mapped as one view, a file larger than the address
+ *			space of the build (over 4 GB in a 32 bit build) is refused with a message rather
+ *			than mapped short, and a view the address space cannot fit fails to map.
+ *
+ *	@param	fileName, a string with the path of the file to map
+ *	@return	bool, true if the file was opened and mapped
+ */
+
+bool Mapped_File::open(std::string fileName)
+{
+	close();
+#ifdef _WIN32
+	HANDLE fileHandle = CreateFileA(fileName.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+	if (fileHandle == INVALID_HANDLE_VALUE) {
+		return false;
+	}
+	LARGE_INTEGER fileSize;
+	if (!GetFileSizeEx(fileHandle, &fileSize)) {
+		CloseHandle(fileHandle);
+		return false;
+	}
+	if ((unsigned long long)fileSize.QuadPart > SIZE_MAX) {
+		// A 32 bit build cannot address the whole file, refuse it rather than map a truncated view
+		std::cout << "File too large to map in a 32 bit build: " << fileName << std::endl;
+		CloseHandle(fileHandle);
+		return false;
+	}
+	pFileHandle = fileHandle;
+	pSize = (std::size_t)fileSize.QuadPart;
+	if (pSize > 0) {
+		HANDLE mapHandle = CreateFileMappingA(fileHandle, NULL, PAGE_READONLY, 0, 0, NULL);
+		if (mapHandle == NULL) {
+			close();
+			return false;
+		}
+		pMapHandle = mapHandle;
+		pData = (const char*)MapViewOfFile(mapHandle, FILE_MAP_READ, 0, 0, 0);
+		if (pData == NULL) {
+			close();
+			return false;
+		}
+	}
+#else
+	int fileHandle = ::open(fileName.c_str(), O_RDONLY);
+	if (fileHandle < 0) {
+		return false;
+	}
+	struct stat fileStat;
+	if (fstat(fileHandle, &fileStat) != 0) {
+		::close(fileHandle);
+		return false;
+	}
+	if ((unsigned long long)fileStat.st_size > SIZE_MAX) {
+		std::cout << "File too large to map in a 32 bit build: " << fileName << std::endl;
+		::close(fileHandle);
+		return false;
+	}
+	pFileHandle = fileHandle;
+	pSize = (std::size_t)fileStat.st_size;
+	if (pSize > 0) {
+		void* mapping = mmap(NULL, pSize, PROT_READ, MAP_PRIVATE, fileHandle, 0);
+		if (mapping == MAP_FAILED) {
+			close();
+			return false;
+		}
+		madvise(mapping, pSize, MADV_SEQUENTIAL);
+		pData = (const char*)mapping;
+	}
+#endif
+	pOpen = true;
+	return decompress(fileName);
+}
+
+/**
+ *	@brief	Replaces the mapped contents of a compressed file with its decompressed contents.
+ *			Files are only treated as gzip when both the name ends in .gz and the data starts
+ *			with the gzip magic number, so binary files are never decompressed by chance. The
+ *			mapping is released once the file has been decompressed. zstd files are not
+ *			supported and are closed rather than read as text.
+ *
+ *	@param	fileName, a string with the path of the mapped file
+ *	@return	bool, false if the file was closed
+ */
+
+bool Mapped_File::decompress(std::string fileName)
+{
+	static const unsigned char zstdMagic[4] = {0x28, 0xB5, 0x2F, 0xFD};
+	bool gzipName = fileName.size() > 3 && fileName.compare(fileName.size() - 3, 3, ".gz") == 0;
+	bool zstdName = fileName.size() > 4 && fileName.compare(fileName.size() - 4, 4, ".zst") == 0;
+	if (zstdName && pSize >= 4 && memcmp(pData, zstdMagic, 4) == 0) {
+		close();
+		return false;
+	}
+	if (!gzipName || !Gzip_Inflater::is_gzip(pData, pData + pSize)) {
+		return true;
+	}
+	std::vector<char> inflated;
+	Gzip_Inflater inflater(pData, pData + pSize);
+	bool good = inflater.inflate(inflated);
+	close();
+	if (!good) {
+		return false;
+	}
+	pInflated.swap(inflated);
+	pSize = pInflated.size();
+	pData = pSize > 0 ? &pInflated[0] : NULL;
+	pOpen = true;
+	return true;
+}
+
+void Mapped_File::close()
+{
+#ifdef _WIN32
+	if (pData != NULL && pInflated.empty()) {
+		UnmapViewOfFile(pData);
+	}
+	if (pMapHandle != NULL) {
+		CloseHandle(pMapHandle);
+	}
+	if (pFileHandle != INVALID_HANDLE_VALUE) {
+		CloseHandle(pFileHandle);
+	}
+	pMapHandle = NULL;
+	pFileHandle = INVALID_HANDLE_VALUE;
+#else
+	if (pData != NULL && pInflated.empty()) {
+		munmap((void*)pData, pSize);
+	}
+	if (pFileHandle >= 0) {
+		::close(pFileHandle);
+	}
+	pFileHandle = -1;
+#endif
+	std::vector<char>().swap(pInflated);
+	pData = NULL;
+	pSize = 0;
+	pOpen = false;
+}
+
+bool Mapped_File::is_open()
+{
+	return pOpen;
+}
+
+const char* Mapped_File::begin()
+{
+	return pData;
+}
+
+const char* Mapped_File::end()
+{
+	return pData + pSize;
+}
+
+std::size_t Mapped_File::size()
+{
+	return pSize;
+}
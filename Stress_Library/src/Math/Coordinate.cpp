@@ -10,17 +10,21 @@
  */
 
 #include "Math/Coordinate.h"
+#include "IO/Binary_Writer.h"
+#include "IO/Binary_Reader.h"
 #include <cmath>
 
 
 Coordinate::Coordinate()
 {
 	set_coordinates(0.0, 0.0, 0.0);
+	pRef = 0;
 }
 
 Coordinate::Coordinate(double x, double y, double z)
 {
 	set_coordinates(x, y, z);
+	pRef = 0;
 }
 
 Coordinate::~Coordinate()
@@ -125,3 +129,18 @@ Coordinate Coordinate::operator*(double num)
 	return returnCoord;
 }
 
+void Coordinate::writeSnapshot(Binary_Writer &writer)
+{
+	writer.write_double(pCoords[0]);
+	writer.write_double(pCoords[1]);
+	writer.write_double(pCoords[2]);
+	writer.write_ulong(pRef);
+}
+
+void Coordinate::readSnapshot(Binary_Reader &reader)
+{
+	pCoords[0] = reader.read_double();
+	pCoords[1] = reader.read_double();
+	pCoords[2] = reader.read_double();
+	pRef = reader.read_ulong();
+}
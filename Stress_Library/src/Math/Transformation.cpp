@@ -12,6 +12,8 @@
 #include "Math/Transformation.h"
 #include "Math/Euclidean_Vector.h"
 #include "Math/Coordinate.h"
+#include "IO/Binary_Writer.h"
+#include "IO/Binary_Reader.h"
 
 #include <iostream>
 
@@ -293,3 +295,20 @@ double Transformation::get_component(unsigned int i, unsigned int j)
 	}
 }
 
+void Transformation::writeSnapshot(Binary_Writer &writer)
+{
+	for (int i = 0; i < 3; i++) {
+		for (int j = 0; j < 3; j++) {
+			writer.write_double(pMatrix[i][j]);
+		}
+	}
+}
+
+void Transformation::readSnapshot(Binary_Reader &reader)
+{
+	for (int i = 0; i < 3; i++) {
+		for (int j = 0; j < 3; j++) {
+			pMatrix[i][j] = reader.read_double();
+		}
+	}
+}
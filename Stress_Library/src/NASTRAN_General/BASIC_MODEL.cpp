@@ -20,17 +20,96 @@
 #include "NASTRAN_General/MAT.h"
 #include "NASTRAN_General/RBE2.h"
 #include "NASTRAN_General/LOAD_CASE.h"
+#include "NASTRAN_General/BDF_Line.h"
+#include "NASTRAN_General/BDF_Buffer.h"
+#include "NASTRAN_General/BDF_Tokenizer.h"
+#include "NASTRAN_General/BDF_Field.h"
+#include "NASTRAN_General/BDF_Profile.h"
+#include "NASTRAN_General/BDF_Region.h"
+#include "NASTRAN_General/BDF_Source.h"
+#include "NASTRAN_General/Punch_Buffer.h"
+#include "NASTRAN_General/Punch_Filter.h"
+#include "NASTRAN_General/Punch_Index.h"
+#include "NASTRAN_General/Punch_Queue.h"
+#include "NASTRAN_General/Punch_Record.h"
+#include "NASTRAN_General/Punch_Stream.h"
+#include "NASTRAN_General/Result_Store.h"
+#include "NASTRAN_General/OP2_Reader.h"
+#include "IO/Mapped_File.h"
+#include "IO/Binary_Writer.h"
+#include "IO/Binary_Reader.h"
+#include "Parallel/Thread_Pool.h"
 
 #include <iostream>
 #include <fstream>
 #include <vector>
 #include <string>
 #include <map>
+#include <set>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <algorithm>
 #include <cstring>
+#include <cctype>
 #include <stdlib.h> 
 #include <sstream>
+#include <chrono>
+#include <cstdio>
+#include <sys/types.h>
+#include <sys/stat.h>
+
+#define BDF_CHUNK_SIZE 8388608	// Bytes of a Bulk Data File per parallel parsing range
+#define PUNCH_CHUNK_SIZE 16777216	// Bytes of a punch file per parallel decoding range
+#define PUNCH_INDEX_EXTENSION ".idx"	// Appended to a punch file name for its index file
+#define SNAPSHOT_MAGIC "FILL_IT_MODEL_SNAPSHOT"
+#define SNAPSHOT_VERSION 2		// Increment when the snapshot layout of any card class changes
+
+/**
+ *	@brief	Packs the card types of a profile into an integer for the snapshot key.
+ *
+ *	@param	profile, the card profile
+ *	@return	unsigned long long, bit n set if card type n is in the profile
+ */
+
+static unsigned long long profileKey(const BDF_Profile &profile)
+{
+	unsigned long long key = 0;
+	for (unsigned int i = 1; i <= 10; i++) {
+		if (profile.has_card(i)) {
+			key |= 1ULL << i;
+		}
+	}
+	return key;
+}
 
 BASIC_MODEL::BASIC_MODEL()
+{
+	init();
+}
+
+BASIC_MODEL::BASIC_MODEL(std::string fileName)
+{
+	init();
+	parseModel(fileName);
+}
+
+BASIC_MODEL::BASIC_MODEL(std::string fileName, BDF_Profile profile)
+{
+	init();
+	pProfile = profile;
+	parseModel(fileName);
+}
+
+BASIC_MODEL::BASIC_MODEL(std::string fileName, BDF_Profile profile, BDF_Region region)
+{
+	init();
+	pProfile = profile;
+	pRegion = region;
+	parseModel(fileName);
+}
+
+void BASIC_MODEL::init()
 {
 	for (int i = 0; i < 7; i++) {
 		pBoolData[i] = false;
@@ -42,46 +121,26 @@ BASIC_MODEL::BASIC_MODEL()
 	pStringData[4] = "CQUAD_Stress";
 	pStringData[5] = "CQUAD_Ply_Stress";
 	pStringData[6] = "Grid_Point_Forces";
+	pRegionPass = 0;
+	pDuplicates = 0;
+	pChangedFiles = 0;
+	pParseIncludes = true;
+	pCQUAD_Results = Result_Store(8);
+	pCBUSH_Results = Result_Store(6);
+	pCQUAD_Plies = Ply_Store(9, false);
+	pPlyStress = false;
+	pFrozen = false;
+	pElementsThawed = false;
+	pHashIndex = true;
 }
 
-BASIC_MODEL::BASIC_MODEL(std::string fileName)
-{
-	BASIC_MODEL();
-	parseModel(fileName);
-}
+/**
+ *	@brief	Deletes the load cases of the model. The cards are destroyed by the card arenas
+ *			that own them, which free their storage a block at a time.
+ */
 
 BASIC_MODEL::~BASIC_MODEL()
 {
-	for (CQUAD_it = CQUAD_Map.begin(); CQUAD_it != CQUAD_Map.end(); CQUAD_it++) {
-		delete CQUAD_it->second;
-	}
-	for (GRID_it = GRID_Map.begin(); GRID_it != GRID_Map.end(); GRID_it++) {
-		delete GRID_it->second;
-	}
-	for (CBUSH_it = CBUSH_Map.begin(); CBUSH_it != CBUSH_Map.end(); CBUSH_it++) {
-		delete CBUSH_it->second;
-	}	
-	for (COORD_it = COORD_Map.begin(); COORD_it != COORD_Map.end(); COORD_it++) {
-		delete COORD_it->second;
-	}	
-	for (PBUSH_it = PBUSH_Map.begin(); PBUSH_it != PBUSH_Map.end(); PBUSH_it++) {
-		delete PBUSH_it->second;
-	}	
-	for (PCOMP_it = PCOMP_Map.begin(); PCOMP_it != PCOMP_Map.end(); PCOMP_it++) {
-		delete PCOMP_it->second;
-	}	
-	for (PSHELL_it = PSHELL_Map.begin(); PSHELL_it != PSHELL_Map.end(); PSHELL_it++) {
-		delete PSHELL_it->second;
-	}	
-	for (MAT_it = MAT_Map.begin(); MAT_it != MAT_Map.end(); MAT_it++) {
-		delete MAT_it->second;
-	}	
-	for (RBE2_it = RBE2_Map.begin(); RBE2_it != RBE2_Map.end(); RBE2_it++) {
-		delete RBE2_it->second;
-	}	
-	for (RBE3_it = RBE3_Map.begin(); RBE3_it != RBE3_Map.end(); RBE3_it++) {
-		delete RBE3_it->second;
-	}	
 	for (LOAD_CASE_it = LOAD_CASE_Map.begin(); LOAD_CASE_it != LOAD_CASE_Map.end(); LOAD_CASE_it++) {
 		delete LOAD_CASE_it->second;
 	}
@@ -89,318 +148,2620 @@ BASIC_MODEL::~BASIC_MODEL()
 
 CQUAD* BASIC_MODEL::getCQUAD(unsigned long ElementID)
 {
-	if (CQUAD_Map.find(ElementID) != CQUAD_Map.end()) {
-		return CQUAD_Map[ElementID];
-	} else {
-		return NULL;
+	unsigned long index;
+	if (pFrozen) {
+		return pCQUAD_Index.find(ElementID, index) ? pCQUADs[index] : NULL;
 	}
+	std::map<unsigned long, CQUAD*>::iterator CQUAD_found = CQUAD_Map.find(ElementID);
+	return CQUAD_found != CQUAD_Map.end() ? CQUAD_found->second : NULL;
 }
 
 GRID* BASIC_MODEL::getGRID(unsigned long GridID)
 {
-	if (GRID_Map.find(GridID) != GRID_Map.end()) {
-		return GRID_Map[GridID];
-	} else {
-		return NULL;
+	unsigned long index;
+	if (pFrozen) {
+		return pGRID_Index.find(GridID, index) ? pGRIDs[index] : NULL;
 	}
+	std::map<unsigned long, GRID*>::iterator GRID_found = GRID_Map.find(GridID);
+	return GRID_found != GRID_Map.end() ? GRID_found->second : NULL;
 }
 
 CBUSH* BASIC_MODEL::getCBUSH(unsigned long ElementID)
 {
-	if (CBUSH_Map.find(ElementID) != CBUSH_Map.end()) {
-		return CBUSH_Map[ElementID];
-	} else {
-		return NULL;
+	unsigned long index;
+	if (pFrozen) {
+		return pCBUSH_Index.find(ElementID, index) ? pCBUSHes[index] : NULL;
+	}
+	std::map<unsigned long, CBUSH*>::iterator CBUSH_found = CBUSH_Map.find(ElementID);
+	return CBUSH_found != CBUSH_Map.end() ? CBUSH_found->second : NULL;
+}
+
+COORD* BASIC_MODEL::getCOORD(unsigned long CoordID)
+{
+	std::map<unsigned long, COORD*>::iterator COORD_found = COORD_Map.find(CoordID);
+	return COORD_found != COORD_Map.end() ? COORD_found->second : NULL;
+}
+
+PBUSH* BASIC_MODEL::getPBUSH(unsigned long PropertyID)
+{
+	std::map<unsigned long, PBUSH*>::iterator PBUSH_found = PBUSH_Map.find(PropertyID);
+	return PBUSH_found != PBUSH_Map.end() ? PBUSH_found->second : NULL;
+}
+
+PCOMP* BASIC_MODEL::getPCOMP(unsigned long PropertyID)
+{
+	std::map<unsigned long, PCOMP*>::iterator PCOMP_found = PCOMP_Map.find(PropertyID);
+	return PCOMP_found != PCOMP_Map.end() ? PCOMP_found->second : NULL;
+}
+
+PSHELL* BASIC_MODEL::getPSHELL(unsigned long PropertyID)
+{
+	std::map<unsigned long, PSHELL*>::iterator PSHELL_found = PSHELL_Map.find(PropertyID);
+	return PSHELL_found != PSHELL_Map.end() ? PSHELL_found->second : NULL;
+}
+
+MAT* BASIC_MODEL::getMAT(unsigned long MaterialID)
+{
+	std::map<unsigned long, MAT*>::iterator MAT_found = MAT_Map.find(MaterialID);
+	return MAT_found != MAT_Map.end() ? MAT_found->second : NULL;
+}
+
+RBE2* BASIC_MODEL::getRBE2(unsigned long ElementID)
+{
+	std::map<unsigned long, RBE2*>::iterator RBE2_found = RBE2_Map.find(ElementID);
+	return RBE2_found != RBE2_Map.end() ? RBE2_found->second : NULL;
+}
+
+RBE3* BASIC_MODEL::getRBE3(unsigned long ElementID)
+{
+	std::map<unsigned long, RBE3*>::iterator RBE3_found = RBE3_Map.find(ElementID);
+	return RBE3_found != RBE3_Map.end() ? RBE3_found->second : NULL;
+}
+
+LOAD_CASE* BASIC_MODEL::getLOAD_CASE(unsigned long SubcaseID)
+{
+	std::map<unsigned long, LOAD_CASE*>::iterator LOAD_CASE_found = LOAD_CASE_Map.find(SubcaseID);
+	return LOAD_CASE_found != LOAD_CASE_Map.end() ? LOAD_CASE_found->second : NULL;
+}
+
+bool BASIC_MODEL::getGRIDIndex(unsigned long GridID, unsigned long &Index)
+{
+	return pFrozen && pGRID_Index.find(GridID, Index);
+}
+
+bool BASIC_MODEL::getCQUADIndex(unsigned long ElementID, unsigned long &Index)
+{
+	return pFrozen && pCQUAD_Index.find(ElementID, Index);
+}
+
+bool BASIC_MODEL::getCBUSHIndex(unsigned long ElementID, unsigned long &Index)
+{
+	return pFrozen && pCBUSH_Index.find(ElementID, Index);
+}
+
+GRID* BASIC_MODEL::getGRIDAt(unsigned long Index)
+{
+	return pFrozen && Index < pGRIDs.size() ? pGRIDs[Index] : NULL;
+}
+
+CQUAD* BASIC_MODEL::getCQUADAt(unsigned long Index)
+{
+	return pFrozen && Index < pCQUADs.size() ? pCQUADs[Index] : NULL;
+}
+
+CBUSH* BASIC_MODEL::getCBUSHAt(unsigned long Index)
+{
+	return pFrozen && Index < pCBUSHes.size() ? pCBUSHes[Index] : NULL;
+}
+
+unsigned long BASIC_MODEL::getGRIDCount()
+{
+	return pFrozen ? pGRIDs.size() : 0;
+}
+
+unsigned long BASIC_MODEL::getCQUADCount()
+{
+	return pFrozen ? pCQUADs.size() : 0;
+}
+
+unsigned long BASIC_MODEL::getCBUSHCount()
+{
+	return pFrozen ? pCBUSHes.size() : 0;
+}
+
+Model_View<CQUAD> BASIC_MODEL::getCQUADView() const
+{
+	return Model_View<CQUAD>(CQUAD_Map);
+}
+
+Model_View<GRID> BASIC_MODEL::getGRIDView() const
+{
+	return Model_View<GRID>(GRID_Map);
+}
+
+Model_View<CBUSH> BASIC_MODEL::getCBUSHView() const
+{
+	return Model_View<CBUSH>(CBUSH_Map);
+}
+
+Model_View<COORD> BASIC_MODEL::getCOORDView() const
+{
+	return Model_View<COORD>(COORD_Map);
+}
+
+Model_View<PBUSH> BASIC_MODEL::getPBUSHView() const
+{
+	return Model_View<PBUSH>(PBUSH_Map);
+}
+
+Model_View<PCOMP> BASIC_MODEL::getPCOMPView() const
+{
+	return Model_View<PCOMP>(PCOMP_Map);
+}
+
+Model_View<PSHELL> BASIC_MODEL::getPSHELLView() const
+{
+	return Model_View<PSHELL>(PSHELL_Map);
+}
+
+Model_View<MAT> BASIC_MODEL::getMATView() const
+{
+	return Model_View<MAT>(MAT_Map);
+}
+
+Model_View<RBE2> BASIC_MODEL::getRBE2View() const
+{
+	return Model_View<RBE2>(RBE2_Map);
+}
+
+Model_View<RBE3> BASIC_MODEL::getRBE3View() const
+{
+	return Model_View<RBE3>(RBE3_Map);
+}
+
+Model_View<LOAD_CASE> BASIC_MODEL::getLOAD_CASEView() const
+{
+	return Model_View<LOAD_CASE>(LOAD_CASE_Map);
+}
+
+std::map<unsigned long, CQUAD*> BASIC_MODEL::getCQUADMap()
+{
+	return CQUAD_Map;
+}
+
+std::map<unsigned long, GRID*> BASIC_MODEL::getGRIDMap()
+{
+	return GRID_Map;
+}
+
+std::map<unsigned long, CBUSH*> BASIC_MODEL::getCBUSHMap()
+{
+	return CBUSH_Map;
+}
+
+std::map<unsigned long, COORD*> BASIC_MODEL::getCOORDMap()
+{
+	return COORD_Map;
+}
+
+std::map<unsigned long, PBUSH*> BASIC_MODEL::getPBUSHMap()
+{
+	return PBUSH_Map;
+}
+
+std::map<unsigned long, PCOMP*> BASIC_MODEL::getPCOMPMap()
+{
+	return PCOMP_Map;
+}
+
+std::map<unsigned long, PSHELL*> BASIC_MODEL::getPSHELLMap()
+{
+	return PSHELL_Map;
+}
+
+std::map<unsigned long, MAT*> BASIC_MODEL::getMATMap()
+{
+	return MAT_Map;
+}
+
+std::map<unsigned long, RBE2*> BASIC_MODEL::getRBE2Map()
+{
+	return RBE2_Map;
+}
+
+std::map<unsigned long, LOAD_CASE*> BASIC_MODEL::getLOAD_CASEMap()
+{
+	return LOAD_CASE_Map;
+}
+
+void BASIC_MODEL::setProfile(BDF_Profile profile)
+{
+	pProfile = profile;
+}
+
+void BASIC_MODEL::setRegion(BDF_Region region)
+{
+	pRegion = region;
+}
+
+void BASIC_MODEL::setSnapshot(std::string snapshotName)
+{
+	pSnapshotName = snapshotName;
+}
+
+void BASIC_MODEL::setPunchFilter(Punch_Filter filter)
+{
+	pPunchFilter = filter;
+}
+
+/**
+ *	@brief	Sets whether QUAD4 composite ply stresses are read from punch files. Ply stresses
+ *			are the largest results punched, so they are only decoded when asked for and are
+ *			dropped by the punch filter like the force results. Changing the precision
+ *			removes the ply stresses held, CQUADs keep their index in the store.
+ *
+ *	@param	Read, a bool flagging whether ply stresses are read
+ *	@param	SinglePrecision, a bool flagging whether ply stresses are stored as float
+ *	@return	void
+ */
+
+void BASIC_MODEL::setPlyStress(bool Read, bool SinglePrecision)
+{
+	pPlyStress = Read;
+	if (SinglePrecision != pCQUAD_Plies.single_precision()) {
+		unsigned long elements = pCQUAD_Plies.element_count();
+		pCQUAD_Plies = Ply_Store(9, SinglePrecision);
+		for (unsigned long i = 0; i < elements; i++) {
+			pCQUAD_Plies.add_element();
+		}
+	}
+}
+
+/**
+ *	@brief	Freezes the GRIDs, CQUADs and CBUSHes of the model into arrays in ID order with an
+ *			index of their IDs, so they are addressed by dense index and found without walking
+ *			the maps. The maps still own the entries and are kept for the code written against
+ *			them. The model is frozen once it is loaded and its elements refrozen once the punch
+ *			readers have added elements, anything else changing the maps must freeze the model
+ *			again.
+ *
+ *	@param	Hashed, a bool flagging whether the ID indices have a hash table, otherwise IDs are
+ *			found by binary search
+ *	@return	void
+ */
+
+void BASIC_MODEL::freezeModel(bool Hashed)
+{
+	std::vector<unsigned long> IDs;
+	pHashIndex = Hashed;
+	pGRIDs.clear();
+	IDs.clear();
+	for (GRID_it = GRID_Map.begin(); GRID_it != GRID_Map.end(); GRID_it++) {
+		IDs.push_back(GRID_it->first);
+		pGRIDs.push_back(GRID_it->second);
+	}
+	pGRID_Index.build(IDs, Hashed);
+	freezeElements();
+	pFrozen = true;
+	pElementsThawed = false;
+}
+
+/**
+ *	@brief	Rebuilds the CQUAD and CBUSH arrays and ID indices of the model, the GRIDs are
+ *			left as they were frozen.
+ *
+ *	@return	void
+ */
+
+void BASIC_MODEL::freezeElements()
+{
+	std::vector<unsigned long> IDs;
+	pCQUADs.clear();
+	for (CQUAD_it = CQUAD_Map.begin(); CQUAD_it != CQUAD_Map.end(); CQUAD_it++) {
+		IDs.push_back(CQUAD_it->first);
+		pCQUADs.push_back(CQUAD_it->second);
+	}
+	pCQUAD_Index.build(IDs, pHashIndex);
+	pCBUSHes.clear();
+	IDs.clear();
+	for (CBUSH_it = CBUSH_Map.begin(); CBUSH_it != CBUSH_Map.end(); CBUSH_it++) {
+		IDs.push_back(CBUSH_it->first);
+		pCBUSHes.push_back(CBUSH_it->second);
+	}
+	pCBUSH_Index.build(IDs, pHashIndex);
+}
+
+/**
+ *	@brief	Refreezes the elements of a model thawed by results adding CQUADs or CBUSHes,
+ *			called once every results file being read has been merged.
+ *
+ *	@return	void
+ */
+
+void BASIC_MODEL::refreezeElements()
+{
+	if (!pElementsThawed) {
+		return;
+	}
+	freezeElements();
+	pFrozen = true;
+	pElementsThawed = false;
+}
+
+/**
+ *	@brief	Thaws the model when results add a CQUAD or CBUSH, elements are then found in the
+ *			maps until refreezeElements is called. GRIDs are only added while a model is loaded,
+ *			which freezes it, so the GRID index is kept.
+ *
+ *	@return	void
+ */
+
+void BASIC_MODEL::thawElements()
+{
+	pFrozen = false;
+	pElementsThawed = true;
+}
+
+/**
+ *	@brief	Sets the composite properties and connectivity of every CQUAD in the frozen model,
+ *			in ID order. The GRIDs of the CQUAD nodes are found by the GRID index.
+ *
+ *	@return	void
+ */
+
+void BASIC_MODEL::connectCQUADs()
+{
+	GRID* grids[4];
+	for (std::size_t i = 0; i < pCQUADs.size(); i++) {
+		pCQUADs[i]->parseComposite(PCOMP_Map, PSHELL_Map, MAT_Map);
+		for (int j = 0; j < 4; j++) {
+			grids[j] = getGRID((*pCQUADs[i])[j + 2]);
+		}
+		pCQUADs[i]->nodeConnect(grids, COORD_Map);
+	}
+}
+
+/**
+ *	@brief	Parses a master Bulk Data File and any files it includes, then sets the model
+ *			connectivity. Only the card types in the profile are loaded. If a region is set
+ *			the model is loaded in two passes by parseRegion.
+ *
+ *	@param	fileName, a string with the path of the master Bulk Data File
+ *	@return	void
+ */
+
+void BASIC_MODEL::parseModel(std::string fileName)
+{
+	if (!pRegion.is_empty()) {
+		parseRegion(fileName);
+		return;
+	}
+	bool loaded = false;
+	if (pSnapshotName.compare("") != 0) {
+		loaded = readSnapshot(pSnapshotName, fileName);
+		if (loaded && pChangedFiles == 0) {
+			return;
+		}
+	}
+	if (!loaded) {
+		pPassProfile = pProfile;
+		if (!readModel(fileName)) {
+			return;
+		}
+		freezeModel(pHashIndex);
+		std::cout << "Parsing composite properties...";
+		for (PCOMP_it = PCOMP_Map.begin(); PCOMP_it != PCOMP_Map.end(); PCOMP_it++) {
+			PCOMP_it->second->parse_Plies(MAT_Map);
+		}
+		std::cout << "Complete" << std::endl;
+		std::cout << "Parsing grid connectivity...";
+		connectCQUADs();
+		for (RBE2_it = RBE2_Map.begin(); RBE2_it != RBE2_Map.end(); RBE2_it++) {
+			RBE2_it->second->nodeConnect(GRID_Map);
+		}	
+		for (RBE3_it = RBE3_Map.begin(); RBE3_it != RBE3_Map.end(); RBE3_it++) {
+			RBE3_it->second->nodeConnect(GRID_Map);
+		}	
+		for (CBUSH_it = CBUSH_Map.begin(); CBUSH_it != CBUSH_Map.end(); CBUSH_it++) {
+			CBUSH_it->second->nodeConnect(GRID_Map, RBE2_Map);
+		}	
+		std::cout << "Complete" << std::endl;	
+	}
+	if (pSnapshotName.compare("") != 0) {
+		if (writeSnapshot(pSnapshotName)) {
+			std::cout << "Model snapshot written to: " << pSnapshotName << std::endl;
+		} else {
+			std::cout << "Unable to write model snapshot: " << pSnapshotName << std::endl;
+		}
+	}
+}
+
+/**
+ *	@brief	Parses a model around the fastener nodes of the region in two passes. The first
+ *			pass loads the GRID, CBUSH, coordinate system and RBE cards and reads only the
+ *			topology of the CQUADs. The region is then selected from the topology and the
+ *			second pass loads the CQUADs and shell properties inside it, so CQUADs outside
+ *			the region are never built or connected.
+ *
+ *	@param	fileName, a string with the path of the master Bulk Data File
+ *	@return	void
+ */
+
+void BASIC_MODEL::parseRegion(std::string fileName)
+{
+	// First pass, CQUAD4 cards are read as topology
+	pPassProfile = pProfile;
+	pPassProfile.remove("PCOMP");
+	pPassProfile.remove("PSHELL");
+	pPassProfile.remove("MAT1");
+	pRegionPass = 1;
+	bool valid = readModel(fileName);
+	pRegionPass = 0;
+	if (!valid) {
+		return;
+	}
+	std::cout << "Selecting region...";
+	for (RBE2_it = RBE2_Map.begin(); RBE2_it != RBE2_Map.end(); RBE2_it++) {
+		RBE2_it->second->nodeConnect(GRID_Map);
+	}	
+	for (RBE3_it = RBE3_Map.begin(); RBE3_it != RBE3_Map.end(); RBE3_it++) {
+		RBE3_it->second->nodeConnect(GRID_Map);
+	}
+	std::size_t topologySize = pRegion.topology_size();
+	pRegion.select(GRID_Map, RBE2_Map, RBE3_Map, COORD_Map);
+	std::cout << "Complete, " << pRegion.CQUAD_size() << " of " << topologySize << " CQUAD elements" << std::endl;
+	// Second pass, CQUADs and shell properties inside the region
+	pPassProfile = pProfile;
+	pPassProfile.remove("GRID");
+	pPassProfile.remove("CBUSH");
+	pPassProfile.remove("CORD2R");
+	pPassProfile.remove("PBUSH");
+	pPassProfile.remove("RBE2");
+	pPassProfile.remove("RBE3");
+	pRegionPass = 2;
+	readModel(fileName);
+	pRegionPass = 0;
+	freezeModel(pHashIndex);
+	std::cout << "Parsing composite properties...";
+	for (PCOMP_it = PCOMP_Map.begin(); PCOMP_it != PCOMP_Map.end(); PCOMP_it++) {
+		PCOMP_it->second->parse_Plies(MAT_Map);
+	}
+	std::cout << "Complete" << std::endl;
+	std::cout << "Parsing grid connectivity...";
+	connectCQUADs();
+	for (CBUSH_it = CBUSH_Map.begin(); CBUSH_it != CBUSH_Map.end(); CBUSH_it++) {
+		CBUSH_it->second->nodeConnect(GRID_Map, RBE2_Map);
+	}	
+	std::cout << "Complete" << std::endl;
+}
+
+/**
+ *	@brief	Reads a master Bulk Data File and any files it includes into the model maps,
+ *			loading the card types of the current pass profile. Files are parsed on a
+ *			thread pool as their INCLUDE entries are found, each into its own card buffer
+ *			(large files are further split into chunk buffers).
+ *			The buffers are then merged into the model maps in the same order the files
+ *			would be read one after another, so the first definition of an ID still wins.
+ *			The cards each file contributed are recorded in the model sources.
+ *
+ *	@param	fileName, a string with the path of the master Bulk Data File
+ *	@return	bool, true if the master file was opened
+ */
+
+bool BASIC_MODEL::readModel(std::string fileName)
+{
+	pSources.clear();
+	pDuplicates = 0;
+	BDF_Buffer* masterBuffer = new BDF_Buffer(fileName);
+	bool valid = false;
+	{
+		Thread_Pool pool;
+		pool.add_task(std::bind(&BASIC_MODEL::parseBDFFile, this, masterBuffer, &pool));
+		pool.wait();
+	}
+	// Merge file buffers breadth first, matching the order includes are found
+	std::deque<BDF_Buffer*> bufferQueue;
+	bufferQueue.push_back(masterBuffer);
+	while (!bufferQueue.empty()) {
+		BDF_Buffer* buffer = bufferQueue.front();
+		bufferQueue.pop_front();
+		// Chunks of a large file follow the file buffer in file order
+		std::vector<BDF_Buffer*> fileParts(1, buffer);
+		fileParts.insert(fileParts.end(), buffer->chunks.begin(), buffer->chunks.end());
+		if (buffer->opened) {
+			valid = true;
+			// The second region pass reads the files listed by the first
+			if (pRegionPass != 2) {
+				std::cout << "Reading: " << buffer->fileName << std::endl;
+				for (int i = 0; i < fileParts.size(); i++) {
+					for (int j = 0; j < fileParts[i]->includes.size(); j++) {
+						std::cout << "Found include file: " << fileParts[i]->includes[j]->fileName << std::endl;
+					}
+				}
+			}
+			pSources.push_back(BDF_Source(buffer->fileName));
+			mergeFile(*buffer, pSources.back());
+		} else {
+			// File did not open
+			std::cout << "Unable to open: " << buffer->fileName << std::endl;
+		}
+		for (int i = 0; i < fileParts.size(); i++) {
+			for (int j = 0; j < fileParts[i]->includes.size(); j++) {
+				bufferQueue.push_back(fileParts[i]->includes[j]);
+			}
+		}
+	}
+	delete masterBuffer;
+	return valid;
+}
+
+/**
+ *	@brief	Parses a single Bulk Data File into a card buffer, run as a thread pool task.
+ *			The file is mapped into memory and card classes are handed views onto the mapped
+ *			lines. Large files are split into byte ranges at card boundaries, the first range
+ *			is parsed into the file buffer and the others are queued into chunk buffers.
+ *
+ *	@param	buffer, a pointer to the card buffer for the file, names the file to parse
+ *	@param	pool, a pointer to the thread pool used to parse chunks and included files
+ *	@return	void
+ */
+
+void BASIC_MODEL::parseBDFFile(BDF_Buffer* buffer, Thread_Pool* pool)
+{
+	std::shared_ptr<Mapped_File> bdfFile(new Mapped_File());
+	if (!bdfFile->open(buffer->fileName)) {
+		return;
+	}
+	buffer->opened = true;
+	// Number of ranges, only split when there are workers free to take them
+	std::size_t chunkCount = 1;
+	if (pool->size() > 1) {
+		chunkCount = bdfFile->size() / BDF_CHUNK_SIZE;
+		if (chunkCount > 4 * pool->size()) {
+			chunkCount = 4 * pool->size();
+		}
+		if (chunkCount < 1) {
+			chunkCount = 1;
+		}
+	}
+	const char* rangeStart = bdfFile->begin();
+	const char* rangeEnd;
+	const char* firstEnd = bdfFile->end();
+	for (std::size_t i = 1; i <= chunkCount; i++) {
+		if (i == chunkCount) {
+			rangeEnd = bdfFile->end();
+		} else {
+			rangeEnd = findCardBoundary(bdfFile->begin() + i * (bdfFile->size() / chunkCount), bdfFile->end());
+		}
+		if (rangeEnd <= rangeStart) {
+			continue;
+		}
+		if (rangeStart == bdfFile->begin()) {
+			firstEnd = rangeEnd;
+		} else {
+			BDF_Buffer* chunkBuffer = new BDF_Buffer(buffer->fileName);
+			chunkBuffer->opened = true;
+			buffer->chunks.push_back(chunkBuffer);
+			pool->add_task(std::bind(&BASIC_MODEL::parseBDFRange, this, chunkBuffer, bdfFile, rangeStart, rangeEnd, pool));
+		}
+		rangeStart = rangeEnd;
+	}
+	parseBDFRange(buffer, bdfFile, bdfFile->begin(), firstEnd, pool);
+}
+
+/**
+ *	@brief	Parses the lines of a byte range of a mapped Bulk Data File into a card buffer.
+ *			The range must start and end on card boundaries so no card is split between
+ *			two ranges. A buffer is created for each INCLUDE entry and queued on the pool,
+ *			unless a single file is being parsed by parseSingleFile.
+ *
+ *	@param	buffer, a pointer to the card buffer to fill
+ *	@param	bdfFile, the mapped file, shared so it stays mapped until every range is parsed
+ *	@param	rangeStart, a pointer to the first line of the range
+ *	@param	rangeEnd, a pointer one past the end of the range
+ *	@param	pool, a pointer to the thread pool used to parse included files
+ *	@return	void
+ */
+
+void BASIC_MODEL::parseBDFRange(BDF_Buffer* buffer, std::shared_ptr<Mapped_File> bdfFile, const char* rangeStart, const char* rangeEnd, Thread_Pool* pool)
+{
+	std::vector<std::string> fileNames;
+	std::vector<BDF_Line> lineEntries;
+	BDF_Line inputLine;
+	const char* cursor = rangeStart;
+	bool parseFlag = false, longFormat = false;
+	unsigned int inputType;
+	while (cursor < rangeEnd) {
+		inputLine = BDF_Line::next_line(cursor, bdfFile->end());
+		// Continuations of cards not in the profile are skipped without further checks
+		if (inputLine.is_continuation()) {
+			if (parseFlag) {
+				lineEntries.push_back(inputLine);
+			}
+		} else if (checkInclude(inputLine, fileNames)) {
+			BDF_Buffer* includeBuffer = new BDF_Buffer(fileNames[fileNames.size() - 1]);
+			buffer->includes.push_back(includeBuffer);
+			if (pParseIncludes) {
+				pool->add_task(std::bind(&BASIC_MODEL::parseBDFFile, this, includeBuffer, pool));
+			}
+			if (parseFlag) {
+				makeEntry(lineEntries, inputType, longFormat, *buffer);
+				parseFlag = false;
+			}
+		} else {
+			checkLine(inputLine, lineEntries, inputType, parseFlag, longFormat, *buffer);
+		}
+	}
+	// Lines are views onto the mapped file, the last card must be made before it is unmapped
+	if (parseFlag) {
+		makeEntry(lineEntries, inputType, longFormat, *buffer);
+	}
+}
+
+/**
+ *	@brief	Finds the first card boundary at or after a position in a file buffer. A card
+ *			boundary is the start of a line that is not a continuation line, so a card and
+ *			its continuations are never split between two ranges.
+ *
+ *	@param	position, a pointer into the file buffer to search from
+ *	@param	fileEnd, a pointer one past the end of the file buffer
+ *	@return	const char*, the start of the boundary line, fileEnd if there is none
+ */
+
+const char* BASIC_MODEL::findCardBoundary(const char* position, const char* fileEnd)
+{
+	// Move to the start of the next line unless already at one
+	if (*(position - 1) != '\n') {
+		const char* newline = (const char*)memchr(position, '\n', fileEnd - position);
+		if (newline == NULL) {
+			return fileEnd;
+		}
+		position = newline + 1;
+	}
+	const char* cursor = position;
+	while (position < fileEnd) {
+		if (!BDF_Line::next_line(cursor, fileEnd).is_continuation()) {
+			return position;
+		}
+		position = cursor;
+	}
+	return fileEnd;
+}
+
+/**
+ *	@brief	Moves the cards held in a buffer into a model map and the buffer arena holding
+ *			them to the end of the model arena. Cards whose ID is already present in the map
+ *			are destroyed, keeping the first definition.
+ *
+ *	@param	Map, the model map to insert into
+ *	@param	Arena, the model arena of the card type
+ *	@param	List, the buffered cards paired with their IDs, emptied on return
+ *	@param	BufferArena, the buffer arena holding the cards, emptied on return
+ *	@param	IDs, the IDs of the cards inserted are appended
+ *	@return	unsigned long, the number of cards destroyed as duplicates
+ */
+
+template <class T>
+static unsigned long mergeList(std::map<unsigned long, T*> &Map, Card_Arena<T> &Arena, std::vector<std::pair<unsigned long, T*> > &List, Card_Arena<T> &BufferArena, std::vector<unsigned long> &IDs)
+{
+	unsigned long duplicates = 0;
+	for (int i = 0; i < List.size(); i++) {
+		if (Map.insert(List[i]).second) {
+			IDs.push_back(List[i].first);
+		} else {
+			Card_Arena<T>::destroy(List[i].second);
+			duplicates++;
+		}
+	}
+	List.clear();
+	Arena.splice(BufferArena);
+	return duplicates;
+}
+
+void BASIC_MODEL::mergeBuffer(BDF_Buffer &buffer, BDF_Source &source)
+{
+	pDuplicates += mergeList(CQUAD_Map, pCQUAD_Arena, buffer.CQUAD_List, buffer.CQUAD_Arena, source.cards[1]);
+	pDuplicates += mergeList(GRID_Map, pGRID_Arena, buffer.GRID_List, buffer.GRID_Arena, source.cards[2]);
+	pDuplicates += mergeList(CBUSH_Map, pCBUSH_Arena, buffer.CBUSH_List, buffer.CBUSH_Arena, source.cards[3]);
+	pDuplicates += mergeList(COORD_Map, pCOORD_Arena, buffer.COORD_List, buffer.COORD_Arena, source.cards[4]);
+	pDuplicates += mergeList(PBUSH_Map, pPBUSH_Arena, buffer.PBUSH_List, buffer.PBUSH_Arena, source.cards[5]);
+	pDuplicates += mergeList(PCOMP_Map, pPCOMP_Arena, buffer.PCOMP_List, buffer.PCOMP_Arena, source.cards[6]);
+	pDuplicates += mergeList(PSHELL_Map, pPSHELL_Arena, buffer.PSHELL_List, buffer.PSHELL_Arena, source.cards[7]);
+	pDuplicates += mergeList(MAT_Map, pMAT_Arena, buffer.MAT_List, buffer.MAT_Arena, source.cards[8]);
+	pDuplicates += mergeList(RBE2_Map, pRBE2_Arena, buffer.RBE2_List, buffer.RBE2_Arena, source.cards[9]);
+	pDuplicates += mergeList(RBE3_Map, pRBE3_Arena, buffer.RBE3_List, buffer.RBE3_Arena, source.cards[10]);
+	pRegion.add_topology(buffer.CQUAD_Topology);
+}
+
+/**
+ *	@brief	Merges the buffer of a file and its chunk buffers into the model maps in file
+ *			order, recording the cards and included files in the file source.
+ *
+ *	@param	buffer, the card buffer of the file
+ *	@param	source, the source record of the file
+ *	@return	void
+ */
+
+void BASIC_MODEL::mergeFile(BDF_Buffer &buffer, BDF_Source &source)
+{
+	std::vector<BDF_Buffer*> fileParts(1, &buffer);
+	fileParts.insert(fileParts.end(), buffer.chunks.begin(), buffer.chunks.end());
+	for (int i = 0; i < fileParts.size(); i++) {
+		mergeBuffer(*fileParts[i], source);
+		for (int j = 0; j < fileParts[i]->includes.size(); j++) {
+			source.includes.push_back(fileParts[i]->includes[j]->fileName);
+		}
+	}
+}
+
+/**
+ *	@brief	Parses a single Bulk Data File into a card buffer without parsing the files
+ *			it includes, the include buffers are left empty and only name the files.
+ *			Large files are still parsed in chunks on a thread pool.
+ *
+ *	@param	fileName, a string with the path of the Bulk Data File
+ *	@return	BDF_Buffer*, the card buffer of the file, deleted by the caller
+ */
+
+BDF_Buffer* BASIC_MODEL::parseSingleFile(std::string fileName)
+{
+	BDF_Buffer* buffer = new BDF_Buffer(fileName);
+	pParseIncludes = false;
+	{
+		Thread_Pool pool;
+		pool.add_task(std::bind(&BASIC_MODEL::parseBDFFile, this, buffer, &pool));
+		pool.wait();
+	}
+	pParseIncludes = true;
+	return buffer;
+}
+
+/**
+ *	@brief	Hashes a block of memory, 64 bit FNV-1a over 8 byte words with a shift to mix
+ *			the high bits down.
+ *
+ *	@param	begin, a pointer to the first byte
+ *	@param	end, a pointer one past the last byte
+ *	@return	unsigned long long, the hash
+ */
+
+static unsigned long long contentHash(const char* begin, const char* end)
+{
+	const char* position = begin;
+	unsigned long long hash = 14695981039346656037ULL;
+	for (; position + 8 <= end; position += 8) {
+		unsigned long long word;
+		std::memcpy(&word, position, 8);
+		hash = (hash ^ word) * 1099511628211ULL;
+		hash ^= hash >> 29;
+	}
+	for (; position < end; position++) {
+		hash = (hash ^ (unsigned char)*position) * 1099511628211ULL;
+	}
+	return hash ^ (unsigned long long)(end - begin);
+}
+
+/**
+ *	@brief	Hashes the content of a file for the model snapshot key.
+ *
+ *	@param	fileName, a string with the path of the file
+ *	@param	size, set to the size of the file in bytes
+ *	@param	hash, set to the hash of the file content
+ *	@return	bool, false if the file could not be opened
+ */
+
+static bool fileHash(std::string fileName, unsigned long long &size, unsigned long long &hash)
+{
+	Mapped_File file;
+	if (!file.open(fileName)) {
+		return false;
+	}
+	size = file.size();
+	hash = contentHash(file.begin(), file.end());
+	return true;
+}
+
+/**
+ *	@brief	Returns the modification time of a file for the punch index key.
+ *
+ *	@param	fileName, a string with the path of the file
+ *	@return	long long, the modification time in seconds, 0 if it could not be read
+ */
+
+static long long fileModified(std::string fileName)
+{
+	struct stat fileStat;
+	if (stat(fileName.c_str(), &fileStat) != 0) {
+		return 0;
+	}
+	return (long long)fileStat.st_mtime;
+}
+
+/**
+ *	@brief	Writes cards of a model map to a snapshot, the card count then each ID and card
+ *			in ID order.
+ *
+ *	@param	writer, the snapshot being written
+ *	@param	Map, the model map holding the cards
+ *	@param	IDs, the IDs of the cards to write
+ *	@return	void
+ */
+
+template <class T>
+static void writeCards(Binary_Writer &writer, std::map<unsigned long, T*> &Map, std::vector<unsigned long> IDs)
+{
+	std::sort(IDs.begin(), IDs.end());
+	writer.write_ulong(IDs.size());
+	for (int i = 0; i < IDs.size(); i++) {
+		writer.write_ulong(IDs[i]);
+		Map.find(IDs[i])->second->writeSnapshot(writer);
+	}
+}
+
+/**
+ *	@brief	Reads cards written by writeCards into a model map. IDs are stored in order so
+ *			each card is inserted with the end of the map as a hint.
+ *
+ *	@param	reader, the snapshot being read
+ *	@param	Map, the model map to fill
+ *	@param	Arena, the model arena the cards are created in
+ *	@param	IDs, the IDs of the cards read are appended
+ *	@return	bool, false if the snapshot ended early or an ID was already in the map
+ */
+
+template <class T>
+static bool readCards(Binary_Reader &reader, std::map<unsigned long, T*> &Map, Card_Arena<T> &Arena, std::vector<unsigned long> &IDs)
+{
+	unsigned long long count = reader.read_ulong();
+	for (unsigned long long i = 0; i < count && reader.good(); i++) {
+		unsigned long ID = reader.read_ulong();
+		T* entry = Arena.create();
+		entry->readSnapshot(reader);
+		if (Map.insert(Map.end(), std::pair<unsigned long, T*>(ID, entry))->second != entry) {
+			Card_Arena<T>::destroy(entry);
+			return false;
+		}
+		IDs.push_back(ID);
+	}
+	return reader.good();
+}
+
+template <class T>
+static void clearMap(std::map<unsigned long, T*> &Map, Card_Arena<T> &Arena)
+{
+	Map.clear();
+	Arena.clear();
+}
+
+/**
+ *	@brief	Destroys the cards left in a stale model map and moves the stale arena to the
+ *			end of the model arena, so the cards swapped into the model by keepUnchanged
+ *			outlive the stale model.
+ *
+ *	@param	Stale, the stale model map, emptied on return
+ *	@param	StaleArena, the arena of the stale model, emptied on return
+ *	@param	Arena, the model arena of the card type
+ *	@return	void
+ */
+
+template <class T>
+static void adoptCards(std::map<unsigned long, T*> &Stale, Card_Arena<T> &StaleArena, Card_Arena<T> &Arena)
+{
+	for (typename std::map<unsigned long, T*>::iterator it = Stale.begin(); it != Stale.end(); it++) {
+		Card_Arena<T>::destroy(it->second);
+	}
+	Stale.clear();
+	Arena.splice(StaleArena);
+}
+
+/**
+ *	@brief	Finds the cards of a type that differ between the cards read from the old
+ *			snapshot sections of changed files and the cards re-parsed from them. Cards
+ *			are compared on their snapshot data.
+ *
+ *	@param	Stale, the cards of the old sections of the changed files
+ *	@param	Map, the model map holding the re-parsed cards
+ *	@param	Added, the IDs of the re-parsed cards
+ *	@return	std::vector<unsigned long>, sorted IDs of the cards added, removed or changed
+ */
+
+template <class T>
+static std::vector<unsigned long> changedCards(std::map<unsigned long, T*> &Stale, std::map<unsigned long, T*> &Map, std::vector<unsigned long> &Added)
+{
+	std::vector<unsigned long> changed;
+	for (typename std::map<unsigned long, T*>::iterator stale_it = Stale.begin(); stale_it != Stale.end(); stale_it++) {
+		typename std::map<unsigned long, T*>::iterator it = Map.find(stale_it->first);
+		if (it == Map.end()) {
+			changed.push_back(stale_it->first);
+			continue;
+		}
+		Binary_Writer staleData, cardData;
+		stale_it->second->writeSnapshot(staleData);
+		it->second->writeSnapshot(cardData);
+		if (!staleData.same(cardData)) {
+			changed.push_back(stale_it->first);
+		}
+	}
+	for (int i = 0; i < Added.size(); i++) {
+		if (Stale.find(Added[i]) == Stale.end()) {
+			changed.push_back(Added[i]);
+		}
+	}
+	std::sort(changed.begin(), changed.end());
+	return changed;
+}
+
+/**
+ *	@brief	Return true if two entries were parsed from the same card data, data set by the
+ *			connection pass is not compared. Cards without connection data are compared
+ *			on their snapshot data.
+ */
+
+static bool sameGRID(GRID* first, GRID* second)
+{
+	for (int i = 0; i < 3; i++) {
+		if ((*first)[i] != (*second)[i] || (*first)(i) != (*second)(i)) {
+			return false;
+		}
+	}
+	return true;
+}
+
+static bool sameCQUAD(CQUAD* first, CQUAD* second)
+{
+	return first->sameBDFData(*second);
+}
+
+template <class T>
+static bool sameCard(T* first, T* second)
+{
+	Binary_Writer firstData, secondData;
+	first->writeSnapshot(firstData);
+	second->writeSnapshot(secondData);
+	return firstData.same(secondData);
+}
+
+/**
+ *	@brief	Keeps the connected entry of the old snapshot section for re-parsed cards that
+ *			did not change. The kept cards are removed from the stale cards and from the
+ *			re-parsed IDs, so neither are reconnected.
+ *
+ *	@param	Stale, the cards of the old sections of the changed files
+ *	@param	Map, the model map holding the re-parsed cards
+ *	@param	Added, the IDs of the re-parsed cards, only the changed and new IDs are left
+ *	@param	same, a function returning true if two cards were parsed from the same data
+ *	@return	void
+ */
+
+template <class T>
+static void keepUnchanged(std::map<unsigned long, T*> &Stale, std::map<unsigned long, T*> &Map, std::vector<unsigned long> &Added, bool (*same)(T*, T*))
+{
+	std::vector<unsigned long> changed;
+	for (int i = 0; i < Added.size(); i++) {
+		typename std::map<unsigned long, T*>::iterator stale_it = Stale.find(Added[i]);
+		typename std::map<unsigned long, T*>::iterator it = Map.find(Added[i]);
+		if (stale_it != Stale.end() && same(stale_it->second, it->second)) {
+			std::swap(stale_it->second, it->second);
+			Card_Arena<T>::destroy(stale_it->second);
+			Stale.erase(stale_it);
+		} else {
+			changed.push_back(Added[i]);
+		}
+	}
+	Added.swap(changed);
+}
+
+//	GRIDs an element connects to, as added to the GRID connectivity by the element nodeConnect
+
+static std::vector<unsigned long> elementGrids(CQUAD* element)
+{
+	std::vector<unsigned long> grids;
+	for (int i = 2; i < 6; i++) {
+		grids.push_back((*element)[i]);
+	}
+	return grids;
+}
+
+static std::vector<unsigned long> elementGrids(CBUSH* element)
+{
+	std::vector<unsigned long> grids;
+	for (int i = 2; i < 4; i++) {
+		grids.push_back((*element)[i]);
+	}
+	return grids;
+}
+
+static std::vector<unsigned long> elementGrids(RBE2* element)
+{
+	std::vector<unsigned long> grids(1, (*element)[1]);
+	for (int i = 3; i < (3 + element->get_num_dependant_nodes()); i++) {
+		grids.push_back((*element)[i]);
+	}
+	return grids;
+}
+
+static std::vector<unsigned long> elementGrids(RBE3* element)
+{
+	std::vector<unsigned long> grids(1, (*element)[1]);
+	for (int i = 3; i < (3 + element->get_num_independant_nodes()); i++) {
+		grids.push_back((*element)[i]);
+	}
+	return grids;
+}
+
+/**
+ *	@brief	Removes the elements of the old sections of changed files from the connectivity
+ *			of their GRIDs.
+ *
+ *	@param	Stale, the elements of the old sections of the changed files
+ *	@param	GRID_Map, a map of all the GRIDs present in the model
+ *	@param	removeConnect, the GRID method removing the element type from its connectivity
+ *	@param	Touched, the IDs of the GRIDs whose connectivity changed are appended
+ *	@return	void
+ */
+
+template <class T>
+static void removeElements(std::map<unsigned long, T*> &Stale, std::map<unsigned long, GRID*> &GRID_Map,
+		bool (GRID::*removeConnect)(unsigned long), std::vector<unsigned long> &Touched)
+{
+	for (typename std::map<unsigned long, T*>::iterator it = Stale.begin(); it != Stale.end(); it++) {
+		std::vector<unsigned long> grids = elementGrids(it->second);
+		for (int i = 0; i < grids.size(); i++) {
+			std::map<unsigned long, GRID*>::iterator Grid_it = GRID_Map.find(grids[i]);
+			if (Grid_it != GRID_Map.end()) {
+				(Grid_it->second->*removeConnect)(it->first);
+				Touched.push_back(grids[i]);
+			}
+		}
+	}
+}
+
+/**
+ *	@brief	Finds the elements to reconnect after a model update, the re-parsed elements and
+ *			the elements connected to any of the GRIDs.
+ *
+ *	@param	Map, the model map of the element type
+ *	@param	Added, the IDs of the re-parsed elements
+ *	@param	Grids, sorted IDs of the GRIDs whose elements are reconnected
+ *	@return	std::vector<T*>, the elements to reconnect
+ */
+
+template <class T>
+static std::vector<T*> affectedElements(std::map<unsigned long, T*> &Map, std::vector<unsigned long> &Added, std::vector<unsigned long> &Grids)
+{
+	std::vector<T*> elements;
+	for (int i = 0; i < Added.size(); i++) {
+		elements.push_back(Map.find(Added[i])->second);
+	}
+	if (Grids.empty()) {
+		return elements;
+	}
+	std::vector<unsigned long> added = Added;
+	std::sort(added.begin(), added.end());
+	for (typename std::map<unsigned long, T*>::iterator it = Map.begin(); it != Map.end(); it++) {
+		if (std::binary_search(added.begin(), added.end(), it->first)) {
+			continue;
+		}
+		std::vector<unsigned long> grids = elementGrids(it->second);
+		for (int i = 0; i < grids.size(); i++) {
+			if (std::binary_search(Grids.begin(), Grids.end(), grids[i])) {
+				elements.push_back(it->second);
+				break;
+			}
+		}
+	}
+	return elements;
+}
+
+static void sortUnique(std::vector<unsigned long> &IDs)
+{
+	std::sort(IDs.begin(), IDs.end());
+	IDs.erase(std::unique(IDs.begin(), IDs.end()), IDs.end());
+}
+
+void BASIC_MODEL::clearModel()
+{
+	clearMap(COORD_Map, pCOORD_Arena);
+	clearMap(GRID_Map, pGRID_Arena);
+	clearMap(CQUAD_Map, pCQUAD_Arena);
+	clearMap(CBUSH_Map, pCBUSH_Arena);
+	clearMap(PBUSH_Map, pPBUSH_Arena);
+	clearMap(PCOMP_Map, pPCOMP_Arena);
+	clearMap(PSHELL_Map, pPSHELL_Arena);
+	clearMap(MAT_Map, pMAT_Arena);
+	clearMap(RBE2_Map, pRBE2_Arena);
+	clearMap(RBE3_Map, pRBE3_Arena);
+	pCQUAD_Results.clear();
+	pCBUSH_Results.clear();
+	pCQUAD_Plies.clear();
+	pSources.clear();
+	pGRID_Index.clear();
+	pCQUAD_Index.clear();
+	pCBUSH_Index.clear();
+	pGRIDs.clear();
+	pCQUADs.clear();
+	pCBUSHes.clear();
+	pFrozen = false;
+	pElementsThawed = false;
+}
+
+/**
+ *	@brief	Writes the snapshot section of a model file, the cards the file contributed to
+ *			the model by card type.
+ *
+ *	@param	writer, the snapshot being written
+ *	@param	source, the source record of the file
+ *	@return	void
+ */
+
+void BASIC_MODEL::writeSection(Binary_Writer &writer, BDF_Source &source)
+{
+	writeCards(writer, COORD_Map, source.cards[4]);
+	writeCards(writer, GRID_Map, source.cards[2]);
+	writeCards(writer, CQUAD_Map, source.cards[1]);
+	writeCards(writer, CBUSH_Map, source.cards[3]);
+	writeCards(writer, PBUSH_Map, source.cards[5]);
+	writeCards(writer, PCOMP_Map, source.cards[6]);
+	writeCards(writer, PSHELL_Map, source.cards[7]);
+	writeCards(writer, MAT_Map, source.cards[8]);
+	writeCards(writer, RBE2_Map, source.cards[9]);
+	writeCards(writer, RBE3_Map, source.cards[10]);
+}
+
+/**
+ *	@brief	Reads the snapshot section of a model file written by writeSection into the
+ *			model maps, recording the cards in the file source.
+ *
+ *	@param	reader, the snapshot being read
+ *	@param	source, the source record of the file
+ *	@return	bool, false if the section is damaged
+ */
+
+bool BASIC_MODEL::readSection(Binary_Reader &reader, BDF_Source &source)
+{
+	return readCards(reader, COORD_Map, pCOORD_Arena, source.cards[4])
+		&& readCards(reader, GRID_Map, pGRID_Arena, source.cards[2])
+		&& readCards(reader, CQUAD_Map, pCQUAD_Arena, source.cards[1])
+		&& readCards(reader, CBUSH_Map, pCBUSH_Arena, source.cards[3])
+		&& readCards(reader, PBUSH_Map, pPBUSH_Arena, source.cards[5])
+		&& readCards(reader, PCOMP_Map, pPCOMP_Arena, source.cards[6])
+		&& readCards(reader, PSHELL_Map, pPSHELL_Arena, source.cards[7])
+		&& readCards(reader, MAT_Map, pMAT_Arena, source.cards[8])
+		&& readCards(reader, RBE2_Map, pRBE2_Arena, source.cards[9])
+		&& readCards(reader, RBE3_Map, pRBE3_Arena, source.cards[10]);
+}
+
+/**
+ *	@brief	Writes the parsed and connected model to a binary snapshot. The snapshot is
+ *			keyed on the profile and holds a table of every model file read, with its size,
+ *			content hash and included files, then a section per file with the cards it
+ *			contributed, including GRID connectivity, CQUAD centroids and CBUSH fastener
+ *			nodes. Results are not written.
+ *
+ *	@param	snapshotName, a string with the path of the snapshot file
+ *	@return	bool, false if a model file could not be hashed or the snapshot not written
+ */
+
+bool BASIC_MODEL::writeSnapshot(std::string snapshotName)
+{
+	Binary_Writer writer;
+	writer.write_string(SNAPSHOT_MAGIC);
+	writer.write_ulong(SNAPSHOT_VERSION);
+	writer.write_ulong(profileKey(pProfile));
+	// Cards dropped as duplicates are not in any section, a file change then needs a full parse
+	writer.write_bool(pDuplicates > 0);
+	writer.write_ulong(pSources.size());
+	for (int i = 0; i < pSources.size(); i++) {
+		if (!pSources[i].hashed) {
+			if (!fileHash(pSources[i].fileName, pSources[i].size, pSources[i].hash)) {
+				return false;
+			}
+			pSources[i].hashed = true;
+		}
+		writer.write_string(pSources[i].fileName);
+		writer.write_ulong(pSources[i].size);
+		writer.write_ulong(pSources[i].hash);
+		writer.write_ulong(pSources[i].includes.size());
+		for (int j = 0; j < pSources[i].includes.size(); j++) {
+			writer.write_string(pSources[i].includes[j]);
+		}
+	}
+	for (int i = 0; i < pSources.size(); i++) {
+		writeSection(writer, pSources[i]);
+	}
+	return writer.save(snapshotName);
+}
+
+/**
+ *	@brief	Loads the model from a binary snapshot written by writeSnapshot. The snapshot
+ *			is only used if its version and profile match and it was written for the same
+ *			master file. The model files are walked from the master file in the order
+ *			readModel reads them, unchanged files use the include list of the snapshot and
+ *			changed or new files are re-parsed on their own. Sections of unchanged files
+ *			are loaded into the model, sections of changed or no longer included files are
+ *			loaded aside and used by patchConnectivity to update the connectivity.
+ *
+ *	@param	snapshotName, a string with the path of the snapshot file
+ *	@param	fileName, a string with the path of the master Bulk Data File
+ *	@return	bool, true if the model was loaded, false leaves the model empty
+ */
+
+bool BASIC_MODEL::readSnapshot(std::string snapshotName, std::string fileName)
+{
+	pChangedFiles = 0;
+	Binary_Reader reader;
+	if (!reader.open(snapshotName)) {
+		return false;
+	}
+	if (reader.read_string().compare(SNAPSHOT_MAGIC) != 0 || reader.read_ulong() != SNAPSHOT_VERSION || reader.read_ulong() != profileKey(pProfile)) {
+		std::cout << "Model snapshot out of date: " << snapshotName << std::endl;
+		return false;
+	}
+	bool duplicates = reader.read_bool();
+	// File table, files are hashed as they are read
+	std::vector<BDF_Source> sources;
+	std::vector<bool> changed;
+	std::map<std::string, std::size_t> sourceIndex;
+	unsigned long long fileCount = reader.read_ulong();
+	for (unsigned long long i = 0; i < fileCount && reader.good(); i++) {
+		BDF_Source source(reader.read_string());
+		source.size = reader.read_ulong();
+		source.hash = reader.read_ulong();
+		unsigned long long includeCount = reader.read_ulong();
+		for (unsigned long long j = 0; j < includeCount && reader.good(); j++) {
+			source.includes.push_back(reader.read_string());
+		}
+		unsigned long long size, hash;
+		source.hashed = fileHash(source.fileName, size, hash) && size == source.size && hash == source.hash;
+		changed.push_back(!source.hashed);
+		sourceIndex.insert(std::pair<std::string, std::size_t>(source.fileName, sources.size()));
+		sources.push_back(source);
+	}
+	if (!reader.good() || sources.empty() || sources[0].fileName.compare(fileName) != 0) {
+		std::cout << "Model snapshot out of date: " << snapshotName << std::endl;
+		return false;
+	}
+	// Walk the model files, re-parsing changed and new files
+	pPassProfile = pProfile;
+	std::vector<BDF_Source> modelSources;
+	std::vector<std::size_t> modelIndex(sources.size(), 0);
+	std::vector<bool> kept(sources.size(), false);
+	std::vector<BDF_Buffer*> parsedBuffers;
+	std::vector<std::size_t> parsedIndex;
+	std::deque<std::string> fileQueue(1, fileName);
+	bool valid = true;
+	while (!fileQueue.empty() && valid) {
+		std::string name = fileQueue.front();
+		fileQueue.pop_front();
+		std::map<std::string, std::size_t>::iterator index_it = sourceIndex.find(name);
+		if (index_it != sourceIndex.end() && !changed[index_it->second]) {
+			// A file included twice is parsed twice by readModel, only a full parse matches it
+			if (kept[index_it->second]) {
+				valid = false;
+				break;
+			}
+			kept[index_it->second] = true;
+			modelIndex[index_it->second] = modelSources.size();
+			BDF_Source source = sources[index_it->second];
+			modelSources.push_back(source);
+			fileQueue.insert(fileQueue.end(), source.includes.begin(), source.includes.end());
+			continue;
+		}
+		std::cout << "Model snapshot out of date, changed file: " << name << std::endl;
+		if (duplicates) {
+			valid = false;
+			break;
+		}
+		pChangedFiles++;
+		BDF_Buffer* buffer = parseSingleFile(name);
+		if (!buffer->opened) {
+			std::cout << "Unable to open: " << name << std::endl;
+			valid = name.compare(fileName) != 0;
+			delete buffer;
+			continue;
+		}
+		std::cout << "Reading: " << name << std::endl;
+		parsedBuffers.push_back(buffer);
+		parsedIndex.push_back(modelSources.size());
+		modelSources.push_back(BDF_Source(name));
+		std::vector<BDF_Buffer*> fileParts(1, buffer);
+		fileParts.insert(fileParts.end(), buffer->chunks.begin(), buffer->chunks.end());
+		for (int i = 0; i < fileParts.size(); i++) {
+			for (int j = 0; j < fileParts[i]->includes.size(); j++) {
+				fileQueue.push_back(fileParts[i]->includes[j]->fileName);
+			}
+		}
+	}
+	if (!valid) {
+		for (int i = 0; i < parsedBuffers.size(); i++) {
+			delete parsedBuffers[i];
+		}
+		pChangedFiles = 0;
+		return false;
+	}
+	// Sections of unchanged files are loaded into the model, the others aside
+	std::cout << "Reading model snapshot: " << snapshotName << std::endl;
+	BASIC_MODEL stale;
+	for (int i = 0; i < sources.size() && valid; i++) {
+		if (kept[i]) {
+			valid = readSection(reader, modelSources[modelIndex[i]]);
+		} else {
+			BDF_Source staleSource;
+			valid = stale.readSection(reader, staleSource);
+		}
+	}
+	if (!valid || !reader.at_end()) {
+		std::cout << "Model snapshot is damaged: " << snapshotName << std::endl;
+		for (int i = 0; i < parsedBuffers.size(); i++) {
+			delete parsedBuffers[i];
+		}
+		clearModel();
+		pChangedFiles = 0;
+		return false;
+	}
+	if (pChangedFiles == 0) {
+		pSources = modelSources;
+		freezeModel(pHashIndex);
+		return true;
+	}
+	// Merge the re-parsed files and update the connectivity around them
+	BDF_Source added;
+	pDuplicates = 0;
+	for (int i = 0; i < parsedBuffers.size(); i++) {
+		BDF_Source &source = modelSources[parsedIndex[i]];
+		mergeFile(*parsedBuffers[i], source);
+		for (int type = 1; type <= 10; type++) {
+			added.cards[type].insert(added.cards[type].end(), source.cards[type].begin(), source.cards[type].end());
+		}
+		delete parsedBuffers[i];
+	}
+	bool patched = pDuplicates == 0 && patchConnectivity(stale, added);
+	// Unchanged cards kept from the old sections are still held by the arenas of the stale model
+	adoptCards(stale.CQUAD_Map, stale.pCQUAD_Arena, pCQUAD_Arena);
+	adoptCards(stale.GRID_Map, stale.pGRID_Arena, pGRID_Arena);
+	adoptCards(stale.CBUSH_Map, stale.pCBUSH_Arena, pCBUSH_Arena);
+	adoptCards(stale.COORD_Map, stale.pCOORD_Arena, pCOORD_Arena);
+	adoptCards(stale.PBUSH_Map, stale.pPBUSH_Arena, pPBUSH_Arena);
+	adoptCards(stale.PCOMP_Map, stale.pPCOMP_Arena, pPCOMP_Arena);
+	adoptCards(stale.PSHELL_Map, stale.pPSHELL_Arena, pPSHELL_Arena);
+	adoptCards(stale.MAT_Map, stale.pMAT_Arena, pMAT_Arena);
+	adoptCards(stale.RBE2_Map, stale.pRBE2_Arena, pRBE2_Arena);
+	adoptCards(stale.RBE3_Map, stale.pRBE3_Arena, pRBE3_Arena);
+	if (!patched) {
+		std::cout << "Model snapshot changes need a full parse: " << snapshotName << std::endl;
+		clearModel();
+		pDuplicates = 0;
+		pChangedFiles = 0;
+		return false;
+	}
+	pSources = modelSources;
+	freezeModel(pHashIndex);
+	return true;
+}
+
+/**
+ *	@brief	Updates the connectivity of a model loaded from a snapshot after changed files
+ *			were re-parsed, only the entities affected by the change are reconnected:
+ *			- re-parsed GRIDs, CQUADs and RBEs with unchanged card data replace the new
+ *			  entry with the connected entry of the old section
+ *			- other re-parsed GRIDs and GRIDs no longer in the model are moved
+ *			- elements of the old sections are removed from the connectivity of their GRIDs
+ *			- re-parsed elements and elements connected to a moved GRID are reconnected
+ *			- CBUSH fastener nodes are found again where the connectivity of a node changed
+ *			- composite flags are set again on CQUADs of a changed shell property
+ *			The connectivity lists of changed GRIDs are sorted back into the order a full
+ *			parse builds them in.
+ *
+ *	@param	stale, a model holding the old sections of the changed and removed files
+ *	@param	added, the IDs of the cards re-parsed from the changed files
+ *	@return	bool, false if a coordinate system or material changed, needing a full parse
+ */
+
+bool BASIC_MODEL::patchConnectivity(BASIC_MODEL &stale, BDF_Source &added)
+{
+	// Every GRID position depends on the coordinate systems and every laminate on the materials
+	if (!changedCards(stale.COORD_Map, COORD_Map, added.cards[4]).empty() || !changedCards(stale.MAT_Map, MAT_Map, added.cards[8]).empty()) {
+		return false;
+	}
+	std::cout << "Updating grid connectivity...";
+	for (int i = 0; i < added.cards[6].size(); i++) {
+		PCOMP_Map.find(added.cards[6][i])->second->parse_Plies(MAT_Map);
+	}
+	std::vector<unsigned long> properties = changedCards(stale.PCOMP_Map, PCOMP_Map, added.cards[6]);
+	std::vector<unsigned long> shells = changedCards(stale.PSHELL_Map, PSHELL_Map, added.cards[7]);
+	properties.insert(properties.end(), shells.begin(), shells.end());
+	sortUnique(properties);
+	// Unchanged cards keep their connected entry, GRIDs changed, added or removed are moved
+	keepUnchanged(stale.GRID_Map, GRID_Map, added.cards[2], sameGRID);
+	keepUnchanged(stale.CQUAD_Map, CQUAD_Map, added.cards[1], sameCQUAD);
+	keepUnchanged(stale.RBE2_Map, RBE2_Map, added.cards[9], sameCard<RBE2>);
+	keepUnchanged(stale.RBE3_Map, RBE3_Map, added.cards[10], sameCard<RBE3>);
+	std::vector<unsigned long> moved = added.cards[2];
+	for (std::map<unsigned long, GRID*>::iterator stale_it = stale.GRID_Map.begin(); stale_it != stale.GRID_Map.end(); stale_it++) {
+		moved.push_back(stale_it->first);
+	}
+	sortUnique(moved);
+	std::vector<unsigned long> touched = moved;
+	removeElements(stale.CQUAD_Map, GRID_Map, &GRID::removeCQUAD_Connect, touched);
+	removeElements(stale.CBUSH_Map, GRID_Map, &GRID::removeCBUSH_Connect, touched);
+	removeElements(stale.RBE2_Map, GRID_Map, &GRID::removeRBE2_Connect, touched);
+	removeElements(stale.RBE3_Map, GRID_Map, &GRID::removeRBE3_Connect, touched);
+	// CQUADs
+	std::vector<CQUAD*> CQUADs = affectedElements(CQUAD_Map, added.cards[1], moved);
+	for (int i = 0; i < CQUADs.size(); i++) {
+		CQUADs[i]->parseComposite(PCOMP_Map, PSHELL_Map, MAT_Map);
+		CQUADs[i]->nodeConnect(GRID_Map, COORD_Map);
+		std::vector<unsigned long> grids = elementGrids(CQUADs[i]);
+		touched.insert(touched.end(), grids.begin(), grids.end());
+	}
+	if (!properties.empty()) {
+		for (CQUAD_it = CQUAD_Map.begin(); CQUAD_it != CQUAD_Map.end(); CQUAD_it++) {
+			if (std::binary_search(properties.begin(), properties.end(), (*CQUAD_it->second)[1])) {
+				CQUAD_it->second->parseComposite(PCOMP_Map, PSHELL_Map, MAT_Map);
+			}
+		}
+	}
+	// RBEs
+	std::vector<RBE2*> RBE2s = affectedElements(RBE2_Map, added.cards[9], moved);
+	for (int i = 0; i < RBE2s.size(); i++) {
+		RBE2s[i]->nodeConnect(GRID_Map);
+		std::vector<unsigned long> grids = elementGrids(RBE2s[i]);
+		touched.insert(touched.end(), grids.begin(), grids.end());
+	}
+	std::vector<RBE3*> RBE3s = affectedElements(RBE3_Map, added.cards[10], moved);
+	for (int i = 0; i < RBE3s.size(); i++) {
+		RBE3s[i]->nodeConnect(GRID_Map);
+		std::vector<unsigned long> grids = elementGrids(RBE3s[i]);
+		touched.insert(touched.end(), grids.begin(), grids.end());
+	}
+	// CBUSH fastener nodes depend on the RBE2 connectivity of their nodes
+	sortUnique(touched);
+	std::vector<CBUSH*> CBUSHs = affectedElements(CBUSH_Map, added.cards[3], touched);
+	for (int i = 0; i < CBUSHs.size(); i++) {
+		CBUSHs[i]->nodeConnect(GRID_Map, RBE2_Map);
+		std::vector<unsigned long> grids = elementGrids(CBUSHs[i]);
+		touched.insert(touched.end(), grids.begin(), grids.end());
+	}
+	sortUnique(touched);
+	for (int i = 0; i < touched.size(); i++) {
+		GRID_it = GRID_Map.find(touched[i]);
+		if (GRID_it != GRID_Map.end()) {
+			GRID_it->second->sortConnect();
+		}
+	}
+	std::cout << "Complete, " << CQUADs.size() << " CQUAD, " << CBUSHs.size() << " CBUSH and " << moved.size() << " GRID entries updated" << std::endl;
+	return true;
+}
+
+/**
+ *	@brief	Parses a single results punch file into the model. Large files are decoded in
+ *			ranges of subcase blocks on a thread pool, the punch index is written if the file
+ *			was decoded without one.
+ *
+ *	@param	fileName, the path of the punch file
+ *	@return	void
+ */
+
+void BASIC_MODEL::parsePunchFile(std::string fileName)
+{
+	Punch_Buffer buffer(fileName);
+	{
+		Thread_Pool pool;
+		pool.add_task(std::bind(&BASIC_MODEL::readPunchFile, this, &buffer, &pool));
+		pool.wait();
+	}
+	writePunchIndex(buffer);
+	mergePunch(buffer);
+	refreezeElements();
+}
+
+/**
+ *	@brief	Returns true if a results file name has an .op2 extension, in any case.
+ *
+ *	@param	fileName, the path of the results file
+ *	@return	bool, true for an OP2 file
+ */
+
+static bool is_op2_file(const std::string &fileName)
+{
+	if (fileName.length() < 4 || fileName[fileName.length() - 4] != '.') {
+		return false;
+	}
+	std::string extension = fileName.substr(fileName.length() - 3);
+	for (std::size_t i = 0; i < extension.length(); i++) {
+		extension[i] = std::toupper(extension[i]);
+	}
+	return extension.compare("OP2") == 0;
+}
+
+/**
+ *	@brief	Parses a set of results punch files into the model in three stages. Each file is read
+ *			(mapped and hashed) and its ranges decoded on a thread pool, a decoded range buffer
+ *			is passed back through a bounded reorder queue and the calling thread stores it in
+ *			the model while later ranges are still decoding. Buffers are stored in file order, a
+ *			file buffer before its chunk buffers, so load case titles and results match parsing
+ *			the files one after another. A file is only queued once the ranges of the file before
+ *			it are queued, so the pool decodes buffers in the order they are stored and at most a
+ *			queue of decoded buffers waits to be stored. Files with an .op2 extension are decoded
+ *			as OP2 files. The throughput of each stage is written to the console once every file
+ *			is stored.
+ *
+ *	@param	fileNames, a string vector of the punch file paths
+ *	@return	void
+ */
+
+void BASIC_MODEL::parsePunchFiles(std::vector<std::string> fileNames)
+{
+	if (fileNames.size() == 0) {
+		return;
+	}
+	std::vector<Punch_Buffer*> buffers;
+	Thread_Pool pool;
+	Punch_Queue decoded(4 * pool.size());
+	for (int i = 0; i < fileNames.size(); i++) {
+		buffers.push_back(new Punch_Buffer(fileNames[i]));
+		buffers[i]->decoded = &decoded;
+		if (i > 0) {
+			buffers[i - 1]->nextFile = buffers[i];
+		}
+	}
+	pool.add_task(std::bind(&BASIC_MODEL::decodePunchFile, this, buffers[0], &pool));
+	unsigned long long readBytes = 0, results = 0;
+	double readSeconds = 0.0, decodeSeconds = 0.0, storeSeconds = 0.0;
+	for (int i = 0; i < buffers.size(); i++) {
+		Punch_Buffer &buffer = *buffers[i];
+		// Part 0 is the file buffer, its chunk buffers are only known once it has been decoded
+		for (std::size_t part = 0; part == 0 || part <= buffer.chunks.size(); part++) {
+			Punch_Buffer* next = decoded.pop();
+			std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+			if (part > 0 || reportPunch(buffer)) {
+				mergePunchPart(*next);
+			}
+			storeSeconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+			readBytes += next->readBytes;
+			readSeconds += next->readSeconds;
+			decodeSeconds += next->decodeSeconds;
+			results += next->CQUAD_Results.size() + next->CBUSH_Results.size() + next->Ply_Results.size();
+		}
+		writePunchIndex(buffer);
+		delete buffers[i];
+	}
+	pool.wait();
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+	refreezeElements();
+	storeSeconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+	// Decode times are summed over the workers, the rates are per worker
+	char report[256];
+	snprintf(report, sizeof(report), "Punch results read: %.1f MB at %.0f MB/s, decoded: %llu at %.2f M/s, stored at %.2f M/s", readBytes / 1048576.0, readSeconds > 0.0 ? readBytes / 1048576.0 / readSeconds : 0.0, results, decodeSeconds > 0.0 ? results / decodeSeconds / 1e6 : 0.0, storeSeconds > 0.0 ? results / storeSeconds / 1e6 : 0.0);
+	std::cout << report << std::endl;
+}
+
+/**
+ *	@brief	Reads and decodes a results file into its buffer, run as a thread pool task, then
+ *			passes the buffer to the queue it is stored from. The chunk buffers of a large punch
+ *			file are queued by their own tasks.
+ *
+ *	@param	buffer, a pointer to the buffer holding the file name
+ *	@param	pool, a pointer to the thread pool used to decode the ranges
+ *	@return	void
+ */
+
+void BASIC_MODEL::decodePunchFile(Punch_Buffer* buffer, Thread_Pool* pool)
+{
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+	if (is_op2_file(buffer->fileName)) {
+		queueNextFile(buffer, pool);
+		readOP2File(buffer);
+	} else {
+		readPunchFile(buffer, pool);
+	}
+	buffer->decodeSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count() - buffer->readSeconds;
+	if (buffer->decoded != NULL) {
+		buffer->decoded->push(buffer);
+	}
+}
+
+/**
+ *	@brief	Decodes a range of a punch file into a chunk buffer, run as a thread pool task, then
+ *			passes the buffer to the queue it is stored from if it has one.
+ *
+ *	@param	buffer, a pointer to the chunk buffer
+ *	@param	decode, the call decoding the range into the buffer
+ *	@return	void
+ */
+
+void BASIC_MODEL::decodePunchChunk(Punch_Buffer* buffer, std::function<void()> decode)
+{
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+	decode();
+	buffer->decodeSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+	if (buffer->decoded != NULL) {
+		buffer->decoded->push(buffer);
+	}
+}
+
+/**
+ *	@brief	Queues the next file of a set being stored through a queue, once every range of a
+ *			file is queued. Chunk buffers follow their file buffer in the storage order and the
+ *			next file buffer follows the last of them, so buffers are queued in the order they
+ *			are stored.
+ *
+ *	@param	buffer, a pointer to the file buffer whose ranges are queued
+ *	@param	pool, a pointer to the thread pool used to decode the ranges
+ *	@return	void
+ */
+
+void BASIC_MODEL::queueNextFile(Punch_Buffer* buffer, Thread_Pool* pool)
+{
+	if (buffer->nextFile == NULL) {
+		return;
+	}
+	buffer->nextFile->sequence = buffer->sequence + buffer->chunks.size() + 1;
+	pool->add_task(std::bind(&BASIC_MODEL::decodePunchFile, this, buffer->nextFile, pool));
+}
+
+/**
+ *	@brief	Parses a single OP2 binary results file into the model.
+ *
+ *	@param	fileName, the path of the OP2 file
+ *	@return	void
+ */
+
+void BASIC_MODEL::parseOP2File(std::string fileName)
+{
+	Punch_Buffer buffer(fileName);
+	readOP2File(&buffer);
+	mergePunch(buffer);
+	refreezeElements();
+}
+
+/**
+ *	@brief	Returns true if a results file name ends in .gz, the names Mapped_File decompresses.
+ *
+ *	@param	fileName, the path of the results file
+ *	@return	bool, true for a gzip file
+ */
+
+static bool is_gzip_file(const std::string &fileName)
+{
+	return fileName.size() > 3 && fileName.compare(fileName.size() - 3, 3, ".gz") == 0;
+}
+
+/**
+ *	@brief	Opens a set of results files to be read one subcase at a time by parsePunchSubcase.
+ *			The files are read concurrently for their load cases only, which are merged into
+ *			the model in the order given, and no results are decoded. A punch file without a
+ *			matching index is indexed as it is read and the index written, the stream keeps the
+ *			index of each punch file. The ident records of each subcase of an OP2 file are found
+ *			as it is listed and kept in the stream, so a subcase is read without walking the file.
+ *			Compressed files are refused, they would be decompressed again for every subcase,
+ *			and no file is opened.
+ *
+ *	@param	fileNames, a string vector of the results file paths
+ *	@param	stream, set to the opened files and the subcases the punch filter keeps
+ *	@return	bool, false if a compressed file was given and the stream is empty
+ */
+
+bool BASIC_MODEL::openPunchStream(std::vector<std::string> fileNames, Punch_Stream &stream)
+{
+	stream.clear();
+	for (int i = 0; i < fileNames.size(); i++) {
+		if (is_gzip_file(fileNames[i])) {
+			std::cout << "Compressed results files cannot be streamed, decompress the file or read the results without STREAM: " << fileNames[i] << std::endl;
+			return false;
+		}
+	}
+	std::vector<Punch_Buffer*> buffers;
+	for (int i = 0; i < fileNames.size(); i++) {
+		buffers.push_back(new Punch_Buffer(fileNames[i]));
+		buffers[i]->listing = true;
+	}
+	{
+		Thread_Pool pool;
+		for (int i = 0; i < buffers.size(); i++) {
+			if (is_op2_file(fileNames[i])) {
+				pool.add_task(std::bind(&BASIC_MODEL::readOP2File, this, buffers[i]));
+			} else {
+				pool.add_task(std::bind(&BASIC_MODEL::readPunchFile, this, buffers[i], &pool));
+			}
+		}
+		pool.wait();
+	}
+	std::set<unsigned long> subcases;
+	for (int i = 0; i < buffers.size(); i++) {
+		Punch_Buffer &buffer = *buffers[i];
+		writePunchIndex(buffer);
+		stream.fileNames.push_back(fileNames[i]);
+		stream.indexes.push_back(std::shared_ptr<Punch_Index>());
+		stream.op2Indexes.push_back(std::shared_ptr<OP2_Index>());
+		if (buffer.opened && !is_op2_file(fileNames[i])) {
+			stream.indexes.back() = std::shared_ptr<Punch_Index>(new Punch_Index(buffer.index));
+		} else if (buffer.opened) {
+			stream.op2Indexes.back() = std::shared_ptr<OP2_Index>(new OP2_Index(buffer.op2Index));
+		}
+		std::vector<Punch_Buffer*> fileParts(1, &buffer);
+		fileParts.insert(fileParts.end(), buffer.chunks.begin(), buffer.chunks.end());
+		for (int j = 0; j < fileParts.size(); j++) {
+			for (LOAD_CASE_it = fileParts[j]->LOAD_CASE_Map.begin(); LOAD_CASE_it != fileParts[j]->LOAD_CASE_Map.end(); LOAD_CASE_it++) {
+				subcases.insert(LOAD_CASE_it->first);
+			}
+		}
+		mergePunch(buffer);
+		delete buffers[i];
+	}
+	stream.subcases.assign(subcases.begin(), subcases.end());
+	return true;
+}
+
+/**
+ *	@brief	Replaces the results held by the model with the results of a single subcase of the
+ *			files opened by openPunchStream. The files are decoded concurrently, a file is mapped
+ *			for the subcase and only the blocks of a punch file or the records of an OP2 file
+ *			indexed for the subcase are read, so only the pages of one subcase are held. Files
+ *			that did not open with the stream were reported then and are skipped. A file that
+ *			no longer opens or is no longer the size it was indexed at is reported and fails the
+ *			subcase. Results are merged in the order the files were given, so they match the
+ *			results of the subcase read by parsePunchFiles.
+ *
+ *	@param	stream, the files opened by openPunchStream
+ *	@param	SubcaseID, unsigned long integer of the subcase ID
+ *	@return	bool, false if a file could not be read for the subcase
+ */
+
+bool BASIC_MODEL::parsePunchSubcase(Punch_Stream &stream, unsigned long SubcaseID)
+{
+	clearResults();
+	bool valid = true;
+	std::vector<Punch_Buffer*> buffers;
+	for (int i = 0; i < stream.fileNames.size(); i++) {
+		buffers.push_back(new Punch_Buffer(stream.fileNames[i]));
+		buffers[i]->streamSubcase = SubcaseID;
+	}
+	{
+		Thread_Pool pool;
+		for (int i = 0; i < buffers.size(); i++) {
+			if (!stream.indexes[i] && !stream.op2Indexes[i]) {
+				continue;
+			}
+			unsigned long long size = stream.indexes[i] ? stream.indexes[i]->size : stream.op2Indexes[i]->size;
+			std::shared_ptr<Mapped_File> resultsFile(new Mapped_File());
+			if (!resultsFile->open(stream.fileNames[i])) {
+				std::cout << "Unable to open: " << stream.fileNames[i] << std::endl;
+				valid = false;
+				continue;
+			}
+			if (resultsFile->size() != size) {
+				std::cout << "Results file changed since the stream was opened: " << stream.fileNames[i] << std::endl;
+				valid = false;
+				continue;
+			}
+			buffers[i]->opened = true;
+			if (stream.indexes[i]) {
+				pool.add_task(std::bind(&BASIC_MODEL::parseIndexedRange, this, buffers[i], resultsFile, stream.indexes[i], 0, stream.indexes[i]->blocks.size()));
+			} else {
+				pool.add_task(std::bind(&BASIC_MODEL::readOP2Subcase, this, buffers[i], resultsFile, stream.op2Indexes[i]));
+			}
+		}
+		pool.wait();
+	}
+	for (int i = 0; i < buffers.size(); i++) {
+		mergePunchResults(*buffers[i]);
+		delete buffers[i];
+	}
+	refreezeElements();
+	return valid;
+}
+
+/**
+ *	@brief	Removes the results held by the model. Elements keep their place in the result
+ *			stores and the load cases are kept.
+ *
+ *	@return	void
+ */
+
+void BASIC_MODEL::clearResults()
+{
+	pCQUAD_Results.clear_results();
+	pCBUSH_Results.clear_results();
+	pCQUAD_Plies.clear_results();
+}
+
+/**
+ *	@brief	Returns true if a line of a punch file starts a subcase block ($TITLE).
+ *
+ *	@param	line, a pointer to the start of the line
+ *	@param	end, a pointer one past the end of the buffer
+ *	@return	bool, true for a $TITLE line
+ */
+
+static bool is_punch_title(const char* line, const char* end)
+{
+	return end - line >= 6 && std::memcmp(line, "$TITLE", 6) == 0;
+}
+
+/**
+ *	@brief	Reads a punch file into a buffer, run as a thread pool task. The file is mapped and
+ *			split into ranges that are decoded on the pool, the first range into the file buffer
+ *			and the others into chunk buffers. If the punch index of the file matches its size,
+ *			modification time and content hash the ranges are runs of indexed subcase blocks,
+ *			otherwise they are byte ranges that start on a $TITLE line and the blocks decoded
+ *			are recorded for a new index. A buffer only listing the load cases keeps the index
+ *			used in its own. The model is not modified.
+ *
+ *	@param	buffer, a pointer to the buffer holding the punch file name
+ *	@param	pool, a pointer to the thread pool used to decode the ranges
+ *	@return	void
+ */
+
+void BASIC_MODEL::readPunchFile(Punch_Buffer* buffer, Thread_Pool* pool)
+{
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+	std::shared_ptr<Mapped_File> punchFile(new Mapped_File());
+	if (!punchFile->open(buffer->fileName)) {
+		queueNextFile(buffer, pool);
+		return;
+	}
+	buffer->opened = true;
+	// Key of the file, an index written for another version of the file is not used
+	std::shared_ptr<Punch_Index> index(new Punch_Index());
+	long long modified = fileModified(buffer->fileName);
+	unsigned long long hash = contentHash(punchFile->begin(), punchFile->end());
+	buffer->readBytes = punchFile->size();
+	buffer->readSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+	bool indexed = index->load(buffer->fileName + PUNCH_INDEX_EXTENSION) && index->size == punchFile->size() && index->modified == modified && index->hash == hash;
+	// Number of ranges, only split when there are workers free to take them
+	std::size_t chunkCount = 1;
+	if (pool->size() > 1) {
+		chunkCount = punchFile->size() / PUNCH_CHUNK_SIZE;
+		if (chunkCount > 4 * pool->size()) {
+			chunkCount = 4 * pool->size();
+		}
+		if (chunkCount < 1) {
+			chunkCount = 1;
+		}
+	}
+	if (indexed) {
+		if (buffer->listing) {
+			// The index is kept to read the file one subcase at a time
+			buffer->index = *index;
+		}
+		// Blocks are shared between the ranges by count
+		std::size_t blockCount = index->blocks.size();
+		std::size_t rangeStart = 0;
+		std::size_t firstEnd = blockCount;
+		for (std::size_t i = 1; i <= chunkCount; i++) {
+			std::size_t rangeEnd = i * blockCount / chunkCount;
+			if (rangeEnd <= rangeStart) {
+				continue;
+			}
+			if (rangeStart == 0) {
+				firstEnd = rangeEnd;
+			} else {
+				Punch_Buffer* chunkBuffer = new Punch_Buffer(buffer->fileName);
+				chunkBuffer->opened = true;
+				chunkBuffer->listing = buffer->listing;
+				chunkBuffer->decoded = buffer->decoded;
+				buffer->chunks.push_back(chunkBuffer);
+				chunkBuffer->sequence = buffer->sequence + buffer->chunks.size();
+				std::function<void()> decode = std::bind(&BASIC_MODEL::parseIndexedRange, this, chunkBuffer, punchFile, index, rangeStart, rangeEnd);
+				pool->add_task(std::bind(&BASIC_MODEL::decodePunchChunk, this, chunkBuffer, decode));
+			}
+			rangeStart = rangeEnd;
+		}
+		queueNextFile(buffer, pool);
+		parseIndexedRange(buffer, punchFile, index, 0, firstEnd);
+		return;
+	}
+	buffer->indexing = true;
+	buffer->index.size = punchFile->size();
+	buffer->index.modified = modified;
+	buffer->index.hash = hash;
+	const char* rangeStart = punchFile->begin();
+	const char* rangeEnd;
+	const char* firstEnd = punchFile->end();
+	for (std::size_t i = 1; i <= chunkCount; i++) {
+		if (i == chunkCount) {
+			rangeEnd = punchFile->end();
+		} else {
+			rangeEnd = findPunchBlock(punchFile->begin() + i * (punchFile->size() / chunkCount), punchFile->end());
+		}
+		if (rangeEnd <= rangeStart) {
+			continue;
+		}
+		if (rangeStart == punchFile->begin()) {
+			firstEnd = rangeEnd;
+		} else {
+			Punch_Buffer* chunkBuffer = new Punch_Buffer(buffer->fileName);
+			chunkBuffer->opened = true;
+			chunkBuffer->indexing = true;
+			chunkBuffer->listing = buffer->listing;
+			chunkBuffer->decoded = buffer->decoded;
+			buffer->chunks.push_back(chunkBuffer);
+			chunkBuffer->sequence = buffer->sequence + buffer->chunks.size();
+			std::function<void()> decode = std::bind(&BASIC_MODEL::parsePunchRange, this, chunkBuffer, punchFile, rangeStart, rangeEnd);
+			pool->add_task(std::bind(&BASIC_MODEL::decodePunchChunk, this, chunkBuffer, decode));
+		}
+		rangeStart = rangeEnd;
+	}
+	queueNextFile(buffer, pool);
+	parsePunchRange(buffer, punchFile, punchFile->begin(), firstEnd);
+}
+
+/**
+ *	@brief	Decodes the subcase blocks of a byte range of a mapped punch file into a buffer.
+ *			Lines before the first $TITLE line of the range are skipped. The blocks are added
+ *			to the buffer index if it is being built.
+ *
+ *	@param	buffer, a pointer to the buffer to fill
+ *	@param	punchFile, the mapped file, shared so it stays mapped until every range is decoded
+ *	@param	rangeStart, a pointer to the first line of the range
+ *	@param	rangeEnd, a pointer one past the end of the range
+ *	@return	void
+ */
+
+void BASIC_MODEL::parsePunchRange(Punch_Buffer* buffer, std::shared_ptr<Mapped_File> punchFile, const char* rangeStart, const char* rangeEnd)
+{
+	if (rangeStart >= rangeEnd) {
+		return;
+	}
+	const char* blockStart = rangeStart;
+	if (!is_punch_title(rangeStart, rangeEnd)) {
+		blockStart = findPunchBlock(rangeStart + 1, rangeEnd);
+	}
+	while (blockStart < rangeEnd) {
+		if (!buffer->indexing) {
+			blockStart = decodePunchBlock(*buffer, blockStart, rangeEnd, NULL);
+			continue;
+		}
+		Punch_Block block;
+		block.offset = blockStart - punchFile->begin();
+		blockStart = decodePunchBlock(*buffer, blockStart, rangeEnd, &block);
+		buffer->index.blocks.push_back(block);
+	}
+}
+
+/**
+ *	@brief	Decodes a run of the indexed subcase blocks of a mapped punch file into a buffer.
+ *			Blocks of subcases the punch filter does not keep are not read, nor blocks of other
+ *			subcases when the buffer is reading a single subcase.
+ *
+ *	@param	buffer, a pointer to the buffer to fill
+ *	@param	punchFile, the mapped file, shared so it stays mapped until every range is decoded
+ *	@param	index, the punch index of the file, shared by the ranges
+ *	@param	firstBlock, the index of the first block of the run
+ *	@param	lastBlock, the index one past the last block of the run
+ *	@return	void
+ */
+
+void BASIC_MODEL::parseIndexedRange(Punch_Buffer* buffer, std::shared_ptr<Mapped_File> punchFile, std::shared_ptr<Punch_Index> index, std::size_t firstBlock, std::size_t lastBlock)
+{
+	for (std::size_t i = firstBlock; i < lastBlock; i++) {
+		if (pPunchFilter.has_subcase(index->blocks[i].subcaseID) && (buffer->streamSubcase == 0 || index->blocks[i].subcaseID == buffer->streamSubcase)) {
+			decodeIndexedBlock(*buffer, punchFile->begin(), index->blocks[i]);
+		}
+	}
+}
+
+/**
+ *	@brief	Finds the start of the first subcase block after a position in a punch file buffer,
+ *			a block starts with a $TITLE line. Lines are not read, the buffer is searched for
+ *			a '$' starting a line.
+ *
+ *	@param	position, a pointer into the file buffer to search from, must not be the buffer start
+ *	@param	fileEnd, a pointer one past the end of the file buffer
+ *	@return	const char*, the start of the $TITLE line, fileEnd if there is none
+ */
+
+const char* BASIC_MODEL::findPunchBlock(const char* position, const char* fileEnd)
+{
+	// Move to the start of the next line unless already at one
+	if (*(position - 1) != '\n') {
+		const char* newline = (const char*)memchr(position, '\n', fileEnd - position);
+		if (newline == NULL) {
+			return fileEnd;
+		}
+		position = newline + 1;
+	}
+	// Only header lines start with '$', the lines between them are not split
+	while (position < fileEnd) {
+		if (is_punch_title(position, fileEnd)) {
+			return position;
+		}
+		const char* marker = (const char*)memchr(position + 1, '$', fileEnd - position - 1);
+		while (marker != NULL && *(marker - 1) != '\n') {
+			marker = (const char*)memchr(marker + 1, '$', fileEnd - marker - 1);
+		}
+		if (marker == NULL) {
+			return fileEnd;
+		}
+		position = marker;
+	}
+	return fileEnd;
+}
+
+/**
+ *	@brief	Returns the ID of a punch file result entry, the first 18 columns of its first line
+ *			with all blanks removed, 0 if the line is not an entry.
+ *
+ *	@param	line, the first line of the entry
+ *	@return	unsigned long, the element or grid ID
+ */
+
+static unsigned long punchEntryID(BDF_Line &line)
+{
+	char cstring[19];
+	int length = 0;
+	for (std::size_t i = 0; i < 18 && i < line.length(); i++) {
+		if (line.data()[i] != ' ') {
+			cstring[length++] = line.data()[i];
+		}
+	}
+	cstring[length] = 0;
+	return atol(cstring);
+}
+
+/**
+ *	@brief	Reads the $TITLE line and the six header lines after it of a subcase block, a $TITLE
+ *			inside the header is read as a header line.
+ *
+ *	@param	cursor, a pointer to the $TITLE line, moved past the header
+ *	@param	rangeEnd, a pointer one past the end of the range being decoded
+ *	@param	lineEntries, a string vector receiving the header lines
+ *	@return	bool, false if the range ends inside the header
+ */
+
+static bool readPunchHeader(const char* &cursor, const char* rangeEnd, std::vector<std::string> &lineEntries)
+{
+	while (lineEntries.size() < 7 && cursor < rangeEnd) {
+		BDF_Line inputLine = BDF_Line::next_line(cursor, rangeEnd);
+		lineEntries.push_back(std::string(inputLine.data(), inputLine.length()));
+	}
+	return lineEntries.size() == 7;
+}
+
+/**
+ *	@brief	Decodes a single subcase block of a punch file into a buffer. The $TITLE line and the
+ *			six header lines after it set the load case and result type, result entries follow
+ *			until the next $TITLE line. Decoding of the block stops at the first line that is not
+ *			a result entry, entries the punch filter does not keep are skipped undecoded. A block
+ *			with nothing to decode or index is skipped to the next $TITLE line unread. No
+ *			state is carried between blocks. When the block is being indexed every result entry
+ *			is recorded, including the entries of subcases the filter does not keep. No entries
+ *			are decoded into a buffer only listing the load cases.
+ *
+ *	@param	buffer, the buffer to fill
+ *	@param	blockStart, a pointer to the $TITLE line of the block
+ *	@param	rangeEnd, a pointer one past the end of the range being decoded
+ *	@param	block, the index entry of the block with its file offset set, NULL if not indexing
+ *	@return	const char*, the start of the next block, rangeEnd if there is none
+ */
+
+const char* BASIC_MODEL::decodePunchBlock(Punch_Buffer &buffer, const char* blockStart, const char* rangeEnd, Punch_Block* block)
+{
+	std::vector<std::string> lineEntries;
+	const char* cursor = blockStart;
+	if (!readPunchHeader(cursor, rangeEnd, lineEntries)) {
+		if (block != NULL) {
+			block->length = rangeEnd - blockStart;
+		}
+		return rangeEnd;
+	}
+	// int_data: 0 -> lines per result entry, 1 -> result class, 2 -> element type
+	int int_data[3] = {0, 0, 0};
+	bool selected = checkLoadCase(lineEntries, int_data, buffer) && !buffer.listing;
+	int entryLines = selected || block != NULL ? int_data[0] : 0;
+	if (block != NULL) {
+		block->subcaseID = buffer.subcaseID;
+		block->entriesEnd = cursor - blockStart;
+	}
+	// Entries are dropped before their fields are decoded if the filter does not keep them
+	BDF_Line entry[4];
+	int lineCount = 0;
+	const char* entryStart = cursor;
+	while (cursor < rangeEnd && !is_punch_title(cursor, rangeEnd)) {
+		if (entryLines == 0) {
+			// Nothing to decode or index, the cursor moves to the next block without reading lines
+			cursor = findPunchBlock(cursor, rangeEnd);
+			break;
+		}
+		if (lineCount == 0) {
+			entryStart = cursor;
+		}
+		entry[lineCount++] = BDF_Line::next_line(cursor, rangeEnd);
+		if (lineCount < entryLines) {
+			continue;
+		}
+		lineCount = 0;
+		unsigned long elm_grid_ID = punchEntryID(entry[0]);
+		if (elm_grid_ID == 0) {
+			// Not a result entry, the rest of the block is skipped
+			entryLines = 0;
+			continue;
+		}
+		if (block != NULL) {
+			block->add_entry(entryStart - blockStart, elm_grid_ID);
+			block->entriesEnd = cursor - blockStart;
+		}
+		if (selected) {
+			decodePunchEntry(buffer, entry, int_data[2], elm_grid_ID);
+		}
 	}
-}
-
-COORD* BASIC_MODEL::getCOORD(unsigned long CoordID)
-{
-	if (COORD_Map.find(CoordID) != COORD_Map.end()) {
-		return COORD_Map[CoordID];
-	} else {
-		return NULL;
+	if (block != NULL) {
+		block->length = cursor - blockStart;
 	}
+	return cursor;
 }
 
-PBUSH* BASIC_MODEL::getPBUSH(unsigned long PropertyID)
-{
-	if (PBUSH_Map.find(PropertyID) != PBUSH_Map.end()) {
-		return PBUSH_Map[PropertyID];
-	} else {
-		return NULL;
-	}
-}
+/**
+ *	@brief	Decodes an indexed subcase block of a punch file into a buffer. The header is read
+ *			as for decodePunchBlock, then only the runs of result entries holding an element
+ *			the punch filter keeps are read.
+ *
+ *	@param	buffer, the buffer to fill
+ *	@param	fileBegin, a pointer to the start of the mapped punch file
+ *	@param	block, the index entry of the block
+ *	@return	void
+ */
 
-PCOMP* BASIC_MODEL::getPCOMP(unsigned long PropertyID)
+void BASIC_MODEL::decodeIndexedBlock(Punch_Buffer &buffer, const char* fileBegin, Punch_Block &block)
 {
-	if (PCOMP_Map.find(PropertyID) != PCOMP_Map.end()) {
-		return PCOMP_Map[PropertyID];
-	} else {
-		return NULL;
+	std::vector<std::string> lineEntries;
+	const char* blockStart = fileBegin + block.offset;
+	const char* cursor = blockStart;
+	if (!readPunchHeader(cursor, blockStart + block.length, lineEntries)) {
+		return;
 	}
-}
-
-PSHELL* BASIC_MODEL::getPSHELL(unsigned long PropertyID)
-{
-	if (PSHELL_Map.find(PropertyID) != PSHELL_Map.end()) {
-		return PSHELL_Map[PropertyID];
-	} else {
-		return NULL;
+	int int_data[3] = {0, 0, 0};
+	if (!checkLoadCase(lineEntries, int_data, buffer) || int_data[0] == 0 || buffer.listing) {
+		return;
+	}
+	BDF_Line entry[4];
+	for (std::size_t i = 0; i < block.segments.size(); i++) {
+		Punch_Segment &segment = block.segments[i];
+		if (int_data[2] == 3 ? !pPunchFilter.has_CBUSH_range(segment.minID, segment.maxID) : !pPunchFilter.has_CQUAD_range(segment.minID, segment.maxID)) {
+			continue;
+		}
+		cursor = blockStart + segment.offset;
+		const char* segmentEnd = blockStart + (i + 1 < block.segments.size() ? block.segments[i + 1].offset : block.entriesEnd);
+		while (cursor < segmentEnd) {
+			for (int j = 0; j < int_data[0]; j++) {
+				entry[j] = BDF_Line::next_line(cursor, segmentEnd);
+			}
+			decodePunchEntry(buffer, entry, int_data[2], punchEntryID(entry[0]));
+		}
 	}
 }
 
-MAT* BASIC_MODEL::getMAT(unsigned long MaterialID)
+/**
+ *	@brief	Decodes a result entry into the buffer if the punch filter keeps its element.
+ *
+ *	@param	buffer, the buffer to fill
+ *	@param	entry, the lines of the entry
+ *	@param	elementType, the element type set by checkLoadCase: 1 -> QUAD4 in material axis,
+ *			2 -> QUAD4, 3 -> BUSH, 4 -> QUAD4 composite ply stresses
+ *	@param	elementID, the element ID of the entry
+ *	@return	void
+ */
+
+void BASIC_MODEL::decodePunchEntry(Punch_Buffer &buffer, BDF_Line* entry, int elementType, unsigned long elementID)
 {
-	if (MAT_Map.find(MaterialID) != MAT_Map.end()) {
-		return MAT_Map[MaterialID];
+	if (elementType == 3) {
+		if (!pPunchFilter.has_CBUSH(elementID)) {
+			return;
+		}
+		Punch_CBUSH_Result result;
+		result.elementID = elementID;
+		result.subcaseID = buffer.subcaseID;
+		Punch_Record(entry, 2).decode(result.values, 6);
+		buffer.CBUSH_Results.push_back(result);
+	} else if (elementType == 4) {
+		if (!pPunchFilter.has_CQUAD(elementID)) {
+			return;
+		}
+		// Fields are the ply ID followed by the ply stresses
+		double fields[10];
+		Punch_Record(entry, 4).decode(fields, 10);
+		Punch_Ply_Result result;
+		result.elementID = elementID;
+		result.subcaseID = buffer.subcaseID;
+		result.ply = (unsigned int)fields[0];
+		for (int i = 0; i < 9; i++) {
+			result.values[i] = fields[i + 1];
+		}
+		buffer.Ply_Results.push_back(result);
 	} else {
-		return NULL;
+		if (!pPunchFilter.has_CQUAD(elementID)) {
+			return;
+		}
+		Punch_CQUAD_Result result;
+		result.elementID = elementID;
+		result.subcaseID = buffer.subcaseID;
+		result.in_mat = elementType == 1;
+		Punch_Record(entry, 3).decode(result.values, 8);
+		buffer.CQUAD_Results.push_back(result);
 	}
 }
 
-RBE2* BASIC_MODEL::getRBE2(unsigned long ElementID)
+/**
+ *	@brief	Writes the punch index of a file decoded without one, the blocks of the file buffer
+ *			and its chunk buffers in file order. The index is not written if the file could not
+ *			be opened, a file that cannot be written is skipped.
+ *
+ *	@param	buffer, the buffer read from the punch file
+ *	@return	void
+ */
+
+void BASIC_MODEL::writePunchIndex(Punch_Buffer &buffer)
 {
-	if (RBE2_Map.find(ElementID) != RBE2_Map.end()) {
-		return RBE2_Map[ElementID];
-	} else {
-		return NULL;
+	if (!buffer.opened || !buffer.indexing) {
+		return;
+	}
+	for (int i = 0; i < buffer.chunks.size(); i++) {
+		std::vector<Punch_Block> &blocks = buffer.chunks[i]->index.blocks;
+		buffer.index.blocks.insert(buffer.index.blocks.end(), blocks.begin(), blocks.end());
 	}
+	buffer.index.save(buffer.fileName + PUNCH_INDEX_EXTENSION);
 }
 
-RBE3* BASIC_MODEL::getRBE3(unsigned long ElementID)
+/**
+ *	@brief	Merges a punch file buffer and its chunk buffers into the model in file order. A load
+ *			case already in the model keeps its titles, results for CQUADs outside a loaded
+ *			region are skipped. Results are added to the CQUAD and CBUSH result stores, an
+ *			element is given its index the first time a result is found for it.
+ *
+ *	@param	buffer, the buffer read from the punch file
+ *	@return	void
+ */
+
+void BASIC_MODEL::mergePunch(Punch_Buffer &buffer)
 {
-	if (RBE3_Map.find(ElementID) != RBE3_Map.end()) {
-		return RBE3_Map[ElementID];
-	} else {
-		return NULL;
+	if (reportPunch(buffer)) {
+		mergePunchResults(buffer);
 	}
 }
 
-LOAD_CASE* BASIC_MODEL::getLOAD_CASE(unsigned long SubcaseID)
-{
-	if (LOAD_CASE_Map.find(SubcaseID) != LOAD_CASE_Map.end()) {
-		return LOAD_CASE_Map[SubcaseID];
-	} else {
-		return NULL;
-	}	
-}
+/**
+ *	@brief	Writes the name of a results file being merged to the console, or that it could not
+ *			be opened.
+ *
+ *	@param	buffer, the buffer read from the file
+ *	@return	bool, true if the file was opened
+ */
 
-std::map<unsigned long, CQUAD*> BASIC_MODEL::getCQUADMap()
+bool BASIC_MODEL::reportPunch(Punch_Buffer &buffer)
 {
-	return CQUAD_Map;
+	if (!buffer.opened) {
+		// File did not open
+		std::cout << "Unable to open: " << buffer.fileName << std::endl;
+		return false;
+	}
+	std::cout << "Reading: " << buffer.fileName << std::endl;
+	return true;
 }
 
-std::map<unsigned long, GRID*> BASIC_MODEL::getGRIDMap()
-{
-	return GRID_Map;
-}
+/**
+ *	@brief	Merges the load cases and results of a punch file buffer and its chunk buffers into
+ *			the model in file order, as for mergePunch. Nothing is written to the console.
+ *
+ *	@param	buffer, the buffer read from the punch file
+ *	@return	void
+ */
 
-std::map<unsigned long, CBUSH*> BASIC_MODEL::getCBUSHMap()
+void BASIC_MODEL::mergePunchResults(Punch_Buffer &buffer)
 {
-	return CBUSH_Map;
+	if (!buffer.opened) {
+		return;
+	}
+	mergePunchPart(buffer);
+	for (int i = 0; i < buffer.chunks.size(); i++) {
+		mergePunchPart(*buffer.chunks[i]);
+	}
 }
 
-std::map<unsigned long, COORD*> BASIC_MODEL::getCOORDMap()
-{
-	return COORD_Map;
-}
+/**
+ *	@brief	Merges the load cases and results of a single file or chunk buffer into the model.
+ *			A load case already in the model keeps its titles, results for CQUADs outside a
+ *			loaded region are skipped. Elements added thaw the model, refreezeElements rebuilds
+ *			their indices once every part is merged.
+ *
+ *	@param	part, the file or chunk buffer
+ *	@return	void
+ */
 
-std::map<unsigned long, PBUSH*> BASIC_MODEL::getPBUSHMap()
+void BASIC_MODEL::mergePunchPart(Punch_Buffer &part)
 {
-	return PBUSH_Map;
+	for (int i = 0; i < 3; i++) {
+		if (part.resultTypes[i]) {
+			pBoolData[i] = true;
+		}
+	}
+	if (part.resultTypes[3]) {
+		pBoolData[5] = true;
+	}
+	std::map<unsigned long, LOAD_CASE*>::iterator bufferCase;
+	for (bufferCase = part.LOAD_CASE_Map.begin(); bufferCase != part.LOAD_CASE_Map.end(); bufferCase++) {
+		if (LOAD_CASE_Map.insert(*bufferCase).second) {
+			bufferCase->second = NULL;
+		}
+	}
+	// Elements are found by the frozen indices, an element added thaws the model until every part is merged
+	for (int i = 0; i < part.CQUAD_Results.size(); i++) {
+		Punch_CQUAD_Result &result = part.CQUAD_Results[i];
+		CQUAD* element = getCQUAD(result.elementID);
+		if (element == NULL) {
+			if (!pRegion.is_empty()) {
+				// CQUAD outside the loaded region, result is skipped
+				continue;
+			}
+			element = pCQUAD_Arena.create(result.elementID);
+			CQUAD_Map.insert(std::pair<unsigned long, CQUAD*> (result.elementID, element));
+			thawElements();
+		}
+		element->attachResults(&pCQUAD_Results);
+		element->addForceResult(result.values, result.subcaseID, result.in_mat);
+	}
+	for (int i = 0; i < part.CBUSH_Results.size(); i++) {
+		Punch_CBUSH_Result &result = part.CBUSH_Results[i];
+		CBUSH* element = getCBUSH(result.elementID);
+		if (element == NULL) {
+			element = pCBUSH_Arena.create(result.elementID);
+			CBUSH_Map.insert(std::pair<unsigned long, CBUSH*> (result.elementID, element));
+			thawElements();
+		}
+		element->attachResults(&pCBUSH_Results);
+		element->addForceResult(result.values, result.subcaseID);
+	}
+	for (int i = 0; i < part.Ply_Results.size(); i++) {
+		Punch_Ply_Result &result = part.Ply_Results[i];
+		CQUAD* element = getCQUAD(result.elementID);
+		if (element == NULL) {
+			if (!pRegion.is_empty()) {
+				continue;
+			}
+			element = pCQUAD_Arena.create(result.elementID);
+			CQUAD_Map.insert(std::pair<unsigned long, CQUAD*> (result.elementID, element));
+			thawElements();
+		}
+		element->attachPlyResults(&pCQUAD_Plies);
+		element->addPlyStressResult(result.values, result.ply, result.subcaseID);
+	}
 }
 
-std::map<unsigned long, PCOMP*> BASIC_MODEL::getPCOMPMap()
-{
-	return PCOMP_Map;
-}
+/**
+ *	@brief	Returns a title line of an OP2 subcase in the form read from a punch file header,
+ *			a blank followed by the first 61 characters of the 128 character title.
+ *
+ *	@param	ident, the ident record of the subcase
+ *	@param	word, the first word of the title in the ident record
+ *	@return	std::string, the title
+ */
 
-std::map<unsigned long, PSHELL*> BASIC_MODEL::getPSHELLMap()
+static std::string op2_title(OP2_Record &ident, std::size_t word)
 {
-	return PSHELL_Map;
+	std::string title = " " + ident.string_at(word, 61);
+	title.resize(62, ' ');
+	return title;
 }
 
-std::map<unsigned long, MAT*> BASIC_MODEL::getMATMap()
-{
-	return MAT_Map;
-}
+/**
+ *	@brief	Reads an OP2 file into a buffer, run as a thread pool task. The file is mapped and
+ *			its tables walked in place, the records of element force tables are decoded and
+ *			other tables are skipped. The model is not modified.
+ *
+ *	@param	buffer, a pointer to the buffer holding the OP2 file name
+ *	@return	void
+ */
 
-std::map<unsigned long, RBE2*> BASIC_MODEL::getRBE2Map()
+void BASIC_MODEL::readOP2File(Punch_Buffer* buffer)
 {
-	return RBE2_Map;
+	Mapped_File op2File;
+	if (!op2File.open(buffer->fileName)) {
+		return;
+	}
+	OP2_Reader reader(op2File.begin(), op2File.end());
+	if (!reader.read_header()) {
+		// Not an OP2 file in a layout that is read
+		return;
+	}
+	buffer->opened = true;
+	buffer->op2Index.size = op2File.size();
+	std::string tableName;
+	OP2_Record ident;
+	OP2_Record data;
+	while (reader.next_table(tableName)) {
+		// Result tables are pairs of ident and data records
+		bool forces = tableName.compare(0, 3, "OEF") == 0;
+		std::size_t position = reader.position();
+		while (reader.next_record(ident)) {
+			if (!forces) {
+				position = reader.position();
+				continue;
+			}
+			if (!reader.next_record(data)) {
+				break;
+			}
+			if (buffer->listing) {
+				// Ident records are found again by offset when the subcase is streamed
+				buffer->op2Index.subcases[ident.int_at(3)].push_back(position);
+			}
+			decodeOP2Forces(*buffer, ident, data);
+			position = reader.position();
+		}
+	}
 }
 
-std::map<unsigned long, LOAD_CASE*> BASIC_MODEL::getLOAD_CASEMap()
-{
-	return LOAD_CASE_Map;
-}
+/**
+ *	@brief	Reads a single subcase of an OP2 file into a buffer, run as a thread pool task.
+ *			Only the ident and data records found for the subcase when the file was listed
+ *			are read, the tables are not walked.
+ *
+ *	@param	buffer, a pointer to the buffer reading the subcase
+ *	@param	op2File, the mapped OP2 file, the size it was listed at
+ *	@param	index, the ident record offsets of each subcase of the file
+ *	@return	void
+ */
 
-void BASIC_MODEL::parseModel(std::string fileName)
+void BASIC_MODEL::readOP2Subcase(Punch_Buffer* buffer, std::shared_ptr<Mapped_File> op2File, std::shared_ptr<OP2_Index> index)
 {
-	std::vector<std::string> fileNames;
-	std::vector<std::string> lineEntries;
-	fileNames.push_back(fileName);
-	std::fstream bdfFile;
-	int i = 0;
-	std::string inputLine;
-	bool parseFlag = false, longFormat = false, valid = false;
-	unsigned int inputType;
-	//CQUAD* tempCQUAD;
-	while (i < fileNames.size()) {
-		bdfFile.open(fileNames[i].c_str(), std::ios_base::in);
-		if (bdfFile.is_open()) {
-			valid = true;
-			std::cout << "Reading: " << fileNames[i] << std::endl;
-			while(!bdfFile.eof()) {
-				std::getline(bdfFile, inputLine);
-				checkBDFLine(inputLine);
-				if (checkInclude(inputLine, fileNames)) {
-					std::cout << "Found include file: " << fileNames[fileNames.size() - 1] << std::endl;
-					if (parseFlag) {
-						makeEntry(lineEntries, inputType, longFormat);
-						parseFlag = false;
-					}
-				} else if (inputLine.substr(0,8).compare("        ") == 0 || inputLine.substr(0,8).compare("*       ") == 0) {
-					if (parseFlag) {
-						lineEntries.push_back(inputLine);
-					}
-				} else {
-					checkLine(inputLine, lineEntries, inputType, parseFlag, longFormat);
-				}
-			}
-		} else {
-			// File did not open
-			std::cout << "Unable to open: " << fileNames[i] << std::endl;
-		}	
-		bdfFile.close();
-		i++;
+	std::map<unsigned long, std::vector<std::size_t> >::const_iterator found = index->subcases.find(buffer->streamSubcase);
+	if (found == index->subcases.end()) {
+		return;
 	}
-
-	if (valid) {
-		std::cout << "Parsing composite properties...";
-		for (PCOMP_it = PCOMP_Map.begin(); PCOMP_it != PCOMP_Map.end(); PCOMP_it++) {
-			PCOMP_it->second->parse_Plies(MAT_Map);
-		}
-		std::cout << "Complete" << std::endl;
-		std::cout << "Parsing grid connectivity...";
-		for (CQUAD_it = CQUAD_Map.begin(); CQUAD_it != CQUAD_Map.end(); CQUAD_it++) {
-			CQUAD_it->second->parseComposite(PCOMP_Map, PSHELL_Map, MAT_Map);
-			CQUAD_it->second->nodeConnect(GRID_Map, COORD_Map);
+	OP2_Reader reader(op2File->begin(), op2File->end());
+	OP2_Record ident;
+	OP2_Record data;
+	for (std::size_t i = 0; i < found->second.size(); i++) {
+		if (reader.seek(found->second[i]) && reader.next_record(ident) && reader.next_record(data)) {
+			decodeOP2Forces(*buffer, ident, data);
 		}
-		for (RBE2_it = RBE2_Map.begin(); RBE2_it != RBE2_Map.end(); RBE2_it++) {
-			RBE2_it->second->nodeConnect(GRID_Map);
-		}	
-		for (RBE3_it = RBE3_Map.begin(); RBE3_it != RBE3_Map.end(); RBE3_it++) {
-			RBE3_it->second->nodeConnect(GRID_Map);
-		}	
-		for (CBUSH_it = CBUSH_Map.begin(); CBUSH_it != CBUSH_Map.end(); CBUSH_it++) {
-			CBUSH_it->second->nodeConnect(GRID_Map, RBE2_Map);
-		}	
-		std::cout << "Complete" << std::endl;	
 	}
 }
 
+/**
+ *	@brief	Decodes a subcase of an OP2 element force table into a buffer. Only real static
+ *			SORT1 forces of CQUAD4 (type 33) and CBUSH (type 102) elements are read, the same
+ *			results read from a punch file. The load case is added the first time its subcase
+ *			is found with the titles of the ident record, results the punch filter does not
+ *			keep are skipped undecoded. Only the load case is read into a listing buffer, and
+ *			only the subcase being read into a buffer reading a single subcase.
+ *
+ *	@param	buffer, the buffer to fill
+ *	@param	ident, the ident record of the subcase
+ *	@param	data, the data record of the subcase
+ *	@return	void
+ */
 
-void BASIC_MODEL::parsePunchFile(std::string fileName)
+void BASIC_MODEL::decodeOP2Forces(Punch_Buffer &buffer, OP2_Record &ident, OP2_Record &data)
 {
-	std::fstream punchFile;
-	std::string inputLine;
-	std::vector<std::string> lineEntries;
-	bool load_Case = false;
-	bool data_flag = false;
-	int int_data[3] = {0, 0, 0};
-	punchFile.open(fileName.c_str(), std::ios_base::in);
-	if (punchFile.is_open()) {
-		std::cout << "Reading: " << fileName << std::endl;
-		while(!punchFile.eof()) {
-			std::getline(punchFile, inputLine);
-			if (inputLine.substr(0,6).compare("$TITLE") == 0 && !load_Case) {
-				data_flag = false;
-				load_Case = true;
-				lineEntries.push_back(inputLine);
-				int_data[0] = 6;
-			} else if (data_flag || load_Case) {
-				if (int_data[0] > 0) {
-					lineEntries.push_back(inputLine);
-					int_data[0]--;
-				}
-				if (int_data[0] == 0 && load_Case) {
-					checkLoadCase(lineEntries, int_data);
-					data_flag = true;
-					load_Case = false;
-				} else if (int_data[0] == 0 && data_flag) {
-					makeLoadEntry(lineEntries, int_data);
-					lineEntries.clear();
-				}
-			}
-		}	
-		punchFile.close();
+	// Ident words: 0 -> approach code, 1 -> table code, 2 -> element type, 3 -> subcase, 8 -> format code, 9 -> words per entry
+	if (ident.words() < 146 || ident.int_at(0) / 10 != 1 || ident.int_at(1) != 4 || ident.int_at(8) != 1) {
+		return;
+	}
+	int elementType = ident.int_at(2);
+	int numWide = ident.int_at(9);
+	if (!(elementType == 33 && numWide == 9) && !(elementType == 102 && numWide == 7)) {
+		return;
+	}
+	unsigned long subcaseID = ident.int_at(3);
+	buffer.subcaseID = subcaseID;
+	if (!pPunchFilter.has_subcase(subcaseID) || (buffer.streamSubcase != 0 && subcaseID != buffer.streamSubcase)) {
+		// Subcase not selected, the subcase is skipped and no load case is added
+		return;
+	}
+	if (buffer.LOAD_CASE_Map.find(subcaseID) == buffer.LOAD_CASE_Map.end()) {
+		LOAD_CASE* loadCase = new LOAD_CASE(subcaseID);
+		buffer.LOAD_CASE_Map.insert(std::pair<unsigned long, LOAD_CASE*> (subcaseID, loadCase));
+		loadCase->addTitle(op2_title(ident, 50));
+		loadCase->addSubtitle(op2_title(ident, 82));
+		loadCase->addLabel(op2_title(ident, 114));
+	}
+	// Entries are the element ID * 10 + device code followed by single precision forces
+	char scratch[4 * 9];
+	float value;
+	int elementCode;
+	std::size_t entryCount = data.words() / numWide;
+	if (elementType == 102) {
+		buffer.resultTypes[2] = true;
 	} else {
-		// File did not open
-		std::cout << "Unable to open: " << fileName << std::endl;	
+		buffer.resultTypes[1] = true;
+	}
+	if (buffer.listing) {
+		return;
+	}
+	for (std::size_t i = 0; i < entryCount; i++) {
+		const char* entry = data.entry(i, numWide, scratch);
+		std::memcpy(&elementCode, entry, 4);
+		unsigned long elementID = elementCode / 10;
+		if (elementType == 102) {
+			if (!pPunchFilter.has_CBUSH(elementID)) {
+				continue;
+			}
+			Punch_CBUSH_Result result;
+			result.elementID = elementID;
+			result.subcaseID = subcaseID;
+			for (int j = 0; j < 6; j++) {
+				std::memcpy(&value, entry + 4 * (j + 1), 4);
+				result.values[j] = value;
+			}
+			buffer.CBUSH_Results.push_back(result);
+		} else {
+			if (!pPunchFilter.has_CQUAD(elementID)) {
+				continue;
+			}
+			Punch_CQUAD_Result result;
+			result.elementID = elementID;
+			result.subcaseID = subcaseID;
+			result.in_mat = false;
+			for (int j = 0; j < 8; j++) {
+				std::memcpy(&value, entry + 4 * (j + 1), 4);
+				result.values[j] = value;
+			}
+			buffer.CQUAD_Results.push_back(result);
+		}
 	}
 }
 
+//	Decoded layout of a punch result block, found from the result class and element type lines of its header
+class Punch_Layout
+{
+	public:
+		const char* classLine;		///< Start of the result class line, line 4 of the header
+		int elementNumber;			///< NASTRAN element type number on line 7 of the header
+		bool material;				///< Flags results in the material axis, MATERIAL after the element name
+		int resultClass;			///< Result class: 1 -> element forces, 2 -> element stresses
+		int elementType;			///< Element type decoded: 1 -> QUAD4 in material axis, 2 -> QUAD4, 3 -> BUSH, 4 -> QUAD4 composite plies
+		int entryLines;				///< Lines per result entry
+};
+
+//	Result blocks read by the model, every other block is skipped unread
+static const Punch_Layout punchLayouts[] = {
+	{"$ELEMENT FORCES", 33, true, 1, 1, 3},
+	{"$ELEMENT FORCES", 33, false, 1, 2, 3},
+	{"$ELEMENT FORCES", 102, false, 1, 3, 2},
+	{"$ELEMENT STRESSES", 95, false, 2, 4, 4}
+};
+
+/**
+ *	@brief	Finds the layout of a punch result block from its header. The element type number
+ *			is read from columns 16 -> 28 of the element type line and MATERIAL from columns
+ *			62 -> 69, so only the header lines are compared and not the element name.
+ *
+ *	@param	lineEntries, a string vector of the $TITLE line and the six header lines after it
+ *	@return	const Punch_Layout*, the layout of the block, NULL if the block is not read
+ */
 
-void BASIC_MODEL::makeLoadEntry(std::vector<std::string> &lineEntries, int (&int_data)[3])
+static const Punch_Layout* findPunchLayout(std::vector<std::string> &lineEntries)
 {
-	unsigned long elm_grid_ID;
-	std::string tempString;
-	try {
-		tempString = lineEntries[0].substr(0, 18);
-		elm_grid_ID = atol(trim(tempString).c_str());
-	} catch (int e) {
-		elm_grid_ID = 0;
-	}
-	if (elm_grid_ID != 0) {
-		// Valid entry
-		switch (int_data[2]) {
-			case 1:
-				CQUAD_it = CQUAD_Map.find(elm_grid_ID);
-				if (CQUAD_it == CQUAD_Map.end()) {
-					std::pair<std::map<unsigned long, CQUAD*>::iterator, bool> ret = CQUAD_Map.insert(std::pair<unsigned long, CQUAD*> (elm_grid_ID, new CQUAD(elm_grid_ID)));
-					CQUAD_it = ret.first;
-				} 
-				switch (int_data[1]) {
-					case 1:
-						CQUAD_it->second->addForceResult(lineEntries, LOAD_CASE_it->first, true);
-						int_data[0] = 3;
-						break;
-				}
-				break;
-			case 2:
-				CQUAD_it = CQUAD_Map.find(elm_grid_ID);
-				if (CQUAD_it == CQUAD_Map.end()) {
-					std::pair<std::map<unsigned long, CQUAD*>::iterator, bool> ret = CQUAD_Map.insert(std::pair<unsigned long, CQUAD*> (elm_grid_ID, new CQUAD(elm_grid_ID)));
-					CQUAD_it = ret.first;
-				} 
-				switch (int_data[1]) {
-					case 1:
-						CQUAD_it->second->addForceResult(lineEntries, LOAD_CASE_it->first, false);
-						int_data[0] = 3;
-						break;
-				}
-				break;
-			case 3:
-				CBUSH_it = CBUSH_Map.find(elm_grid_ID);
-				if (CBUSH_it == CBUSH_Map.end()) {
-					std::pair<std::map<unsigned long, CBUSH*>::iterator, bool> ret = CBUSH_Map.insert(std::pair<unsigned long, CBUSH*> (elm_grid_ID, new CBUSH(elm_grid_ID)));
-					CBUSH_it = ret.first;
-				}
-				// Add CBUSH Force
-				switch (int_data[1]) {
-					case 1:
-						CBUSH_it->second->addForceResult(lineEntries, LOAD_CASE_it->first);
-						int_data[0] = 2;
-						break;
-				}
-				break;			
+	const std::string &typeLine = lineEntries[6];
+	if (typeLine.compare(0, 15, "$ELEMENT TYPE =") != 0 || typeLine.length() < 28) {
+		return NULL;
+	}
+	int elementNumber = atoi(typeLine.substr(15, 13).c_str());
+	bool material = typeLine.length() > 61 && typeLine.compare(61, 8, "MATERIAL") == 0;
+	for (std::size_t i = 0; i < sizeof(punchLayouts) / sizeof(punchLayouts[0]); i++) {
+		const Punch_Layout &layout = punchLayouts[i];
+		if (layout.elementNumber == elementNumber && layout.material == material && lineEntries[3].compare(0, std::strlen(layout.classLine), layout.classLine) == 0) {
+			return &layout;
 		}
 	}
+	return NULL;
 }
 
-void BASIC_MODEL::checkLoadCase(std::vector<std::string> &lineEntries, int (&int_data)[3])
+/**
+ *	@brief	Reads the header lines of a subcase block. The layout of the result type sets the
+ *			number of lines per result entry (int_data[0]), left at 0 for results that are not
+ *			read. The load
+ *			case is added to the buffer the first time its subcase is found, unless the punch
+ *			filter does not keep the subcase.
+ *
+ *	@param	lineEntries, a string vector of the $TITLE line and the six header lines after it
+ *	@param	int_data, an int array receiving the lines per entry, result class and element type
+ *	@param	buffer, the buffer the load case is added to
+ *	@return	bool, false if the punch filter does not keep the subcase or the block holds ply
+ *			stresses that are not read
+ */
+
+bool BASIC_MODEL::checkLoadCase(std::vector<std::string> &lineEntries, int (&int_data)[3], Punch_Buffer &buffer)
 {
 	unsigned long subcaseID;
 	std::string tempString;
@@ -410,35 +2771,36 @@ void BASIC_MODEL::checkLoadCase(std::vector<std::string> &lineEntries, int (&int
 	} catch (int e) {
 		subcaseID = 0;
 	}
-	LOAD_CASE_it = LOAD_CASE_Map.find(subcaseID);
-	if (LOAD_CASE_it == LOAD_CASE_Map.end()) {
-		std::pair<std::map<unsigned long, LOAD_CASE*>::iterator, bool> ret = LOAD_CASE_Map.insert(std::pair<unsigned long, LOAD_CASE*> (subcaseID, new LOAD_CASE(subcaseID)));
-		LOAD_CASE_it = ret.first;
+	buffer.subcaseID = subcaseID;
+	// Determine load type from the layout table, blocks without a layout are not decoded
+	const Punch_Layout* layout = findPunchLayout(lineEntries);
+	if (layout != NULL) {
+		int_data[0] = layout->entryLines;
+		int_data[1] = layout->resultClass;
+		int_data[2] = layout->elementType;
+	}
+	if (!pPunchFilter.has_subcase(subcaseID)) {
+		// Subcase not selected, no load case is added
+		return false;
+	}
+	if (buffer.LOAD_CASE_Map.find(subcaseID) == buffer.LOAD_CASE_Map.end()) {
+		LOAD_CASE* loadCase = new LOAD_CASE(subcaseID);
+		buffer.LOAD_CASE_Map.insert(std::pair<unsigned long, LOAD_CASE*> (subcaseID, loadCase));
 		tempString = lineEntries[0].substr(10, 62);
-		LOAD_CASE_it->second->addTitle(tempString);
+		loadCase->addTitle(tempString);
 		tempString = lineEntries[1].substr(10, 62);
-		LOAD_CASE_it->second->addSubtitle(tempString);
+		loadCase->addSubtitle(tempString);
 		tempString = lineEntries[2].substr(10, 62);
-		LOAD_CASE_it->second->addLabel(tempString);
-	}
-	// Determine load type
-	if (lineEntries[3].substr(0, 15).compare("$ELEMENT FORCES") == 0) {
-		int_data[1] = 1;
-		if	(lineEntries[6].substr(0, 69).compare("$ELEMENT TYPE =          33  QUAD4                           MATERIAL") == 0) {
-			int_data[2] = 1;
-			int_data[0] = 3;
-			pBoolData[0] = true;
-		} else if (lineEntries[6].substr(0, 34).compare("$ELEMENT TYPE =          33  QUAD4") == 0) {
-			int_data[2] = 2;
-			int_data[0] = 3;
-			pBoolData[1] = true;
-		} else if (lineEntries[6].substr(0, 33).compare("$ELEMENT TYPE =         102  BUSH") == 0) {
-			int_data[2] = 3;
-			int_data[0] = 2;
-			pBoolData[2] = true;
-		}
-		lineEntries.clear();
-	} 	
+		loadCase->addLabel(tempString);
+	}
+	if (int_data[2] == 4 && !pPlyStress) {
+		// Ply stresses not read, the entries of the block are still indexed
+		return false;
+	}
+	if (int_data[2] != 0) {
+		buffer.resultTypes[int_data[2] - 1] = true;
+	}
+	return true;
 }
 
 std::string BASIC_MODEL::trim(std::string& str)
@@ -464,11 +2826,14 @@ void BASIC_MODEL::checkBDFLine(std::string &str)
 	}
 }
 
-bool BASIC_MODEL::checkInclude(std::string &str, std::vector<std::string> &fileNames)
+bool BASIC_MODEL::checkInclude(BDF_Line &inputLine, std::vector<std::string> &fileNames)
 {
+	if (inputLine[0] != 'I' && inputLine[0] != 'i') {
+		return false;
+	}
 	char cstring[8];
 	for (int i = 0; i < 7; i++) {
-		cstring[i] = str[i];
+		cstring[i] = inputLine[i];
 	}
 	for (int i = 0; i < 7; i++) {
 		if (cstring[i] <= 122 && cstring[i] >= 97) {
@@ -477,6 +2842,7 @@ bool BASIC_MODEL::checkInclude(std::string &str, std::vector<std::string> &fileN
 	}
 	cstring[7] = 0;
 	if (std::strcmp(cstring, "INCLUDE") == 0) {
+		std::string str(inputLine.data(), inputLine.length());
 		std::size_t first = str.find_first_of("'");
 		if (first == std::string::npos) {
 			first = str.find_first_of('"');
@@ -493,173 +2859,171 @@ bool BASIC_MODEL::checkInclude(std::string &str, std::vector<std::string> &fileN
 	}
 }
 
-void BASIC_MODEL::checkLine(std::string &inputLine, std::vector<std::string> &lineEntries, unsigned int &inputType, bool &parseFlag, bool &longFormat)
+/**
+ *	@brief	Packs a card name of up to 8 characters into an integer, one byte per character.
+ *			Used for the case labels of the card dispatch in checkLine.
+ *
+ *	@param	name, a null terminated card name
+ *	@return	unsigned long long, the packed name
+ */
+
+static constexpr unsigned long long cardKey(const char* name)
+{
+	unsigned long long key = 0;
+	for (int i = 0; i < 8 && name[i] != 0; i++) {
+		key = (key << 8) | (unsigned char)name[i];
+	}
+	return key;
+}
+
+/**
+ *	@brief	Packs the card name columns (1 -> 8) of a line into an integer matching cardKey.
+ *			Blanks are skipped, a trailing '*' marks a long format card and is dropped from
+ *			the key so both formats dispatch on the same name.
+ *
+ *	@param	inputLine, a line of the Bulk Data File
+ *	@param	longFormat, set true if the name ends with '*'
+ *	@return	unsigned long long, the packed name
+ */
+
+static unsigned long long lineCardKey(const BDF_Line &inputLine, bool &longFormat)
+{
+	unsigned long long key = 0;
+	char last = 0;
+	for (std::size_t i = 0; i < 8; i++) {
+		char c = inputLine[i];
+		if (c != ' ') {
+			key = (key << 8) | (unsigned char)c;
+			last = c;
+		}
+	}
+	longFormat = last == '*';
+	if (longFormat) {
+		key >>= 8;
+	}
+	return key;
+}
+
+void BASIC_MODEL::checkLine(BDF_Line &inputLine, std::vector<BDF_Line> &lineEntries, unsigned int &inputType, bool &parseFlag, bool &longFormat, BDF_Buffer &buffer)
 {
 	if (parseFlag) {
-		makeEntry(lineEntries, inputType, longFormat);
+		makeEntry(lineEntries, inputType, longFormat, buffer);
 		parseFlag = false;
 	}
-	std::string tempString = inputLine.substr(0,8);
-	if (trim(tempString).compare("CQUAD4") == 0) {
-		lineEntries.push_back(inputLine);
-		inputType = 1;
-		longFormat = false;
-		parseFlag = true;
-	} else if (trim(tempString).compare("CQUAD4*") == 0) {
-		lineEntries.push_back(inputLine);
-		inputType = 1;
-		longFormat = true;
-		parseFlag = true;
-	} else if (trim(tempString).compare("GRID") == 0) {
-		lineEntries.push_back(inputLine);
-		inputType = 2;
-		longFormat = false;
-		parseFlag = true;
-	} else if (trim(tempString).compare("GRID*") == 0) {
-		lineEntries.push_back(inputLine);
-		inputType = 2;
-		longFormat = true;
-		parseFlag = true;
-	} else if (trim(tempString).compare("CBUSH") == 0) {
-		lineEntries.push_back(inputLine);
-		inputType = 3;
-		longFormat = false;
-		parseFlag = true;
-	} else if (trim(tempString).compare("CBUSH*") == 0) {
-		lineEntries.push_back(inputLine);
-		inputType = 3;
-		longFormat = true;
-		parseFlag = true;
-	} else if (trim(tempString).compare("CORD2R") == 0) {
-		lineEntries.push_back(inputLine);
-		inputType = 4;
-		longFormat = false;
-		parseFlag = true;
-	} else if (trim(tempString).compare("CORD2R*") == 0) {
-		lineEntries.push_back(inputLine);
-		inputType = 4;
-		longFormat = true;
-		parseFlag = true;
-	} else if (trim(tempString).compare("PBUSH") == 0) {
-		lineEntries.push_back(inputLine);
-		inputType = 5;
-		longFormat = false;
-		parseFlag = true;
-	} else if (trim(tempString).compare("PBUSH*") == 0) {
-		lineEntries.push_back(inputLine);
-		inputType = 5;
-		longFormat = true;
-		parseFlag = true;
-	} else if (trim(tempString).compare("PCOMP") == 0) {
-		lineEntries.push_back(inputLine);
-		inputType = 6;
-		longFormat = false;
-		parseFlag = true;
-	} else if (trim(tempString).compare("PCOMP*") == 0) {
-		lineEntries.push_back(inputLine);
-		inputType = 6;
-		longFormat = true;
-		parseFlag = true;
-	} else if (trim(tempString).compare("PSHELL") == 0) {
-		lineEntries.push_back(inputLine);
-		inputType = 7;
-		longFormat = false;
-		parseFlag = true;
-	} else if (trim(tempString).compare("PSHELL*") == 0) {
-		lineEntries.push_back(inputLine);
-		inputType = 7;
-		longFormat = true;
-		parseFlag = true;
-	} else if (trim(tempString).compare("MAT1") == 0 || trim(tempString).compare("MAT8") == 0) {
-		lineEntries.push_back(inputLine);
-		inputType = 8;
-		longFormat = false;
-		parseFlag = true;
-	} else if (trim(tempString).compare("MAT1*") == 0 || trim(tempString).compare("MAT8*") == 0) {
-		lineEntries.push_back(inputLine);
-		inputType = 8;
-		longFormat = true;
-		parseFlag = true;
-	} else if (trim(tempString).compare("RBE2") == 0) {
-		lineEntries.push_back(inputLine);
-		inputType = 9;
-		longFormat = false;
-		parseFlag = true;
-	} else if (trim(tempString).compare("RBE2*") == 0) {
-		lineEntries.push_back(inputLine);
-		inputType = 9;
-		longFormat = true;
-		parseFlag = true;
-	} else if (trim(tempString).compare("RBE3") == 0) {
-		lineEntries.push_back(inputLine);
-		inputType = 10;
-		longFormat = false;
-		parseFlag = true;
-	} else if (trim(tempString).compare("RBE3*") == 0) {
-		lineEntries.push_back(inputLine);
-		inputType = 10;
-		longFormat = true;
-		parseFlag = true;
-	}
-}
-
-void BASIC_MODEL::makeEntry(std::vector<std::string> &lineEntries, unsigned int &inputType, bool &longFormat)
+	bool lineLongFormat;
+	switch (lineCardKey(inputLine, lineLongFormat)) {
+		case cardKey("CQUAD4"):
+			inputType = 1;
+			break;
+		case cardKey("GRID"):
+			inputType = 2;
+			break;
+		case cardKey("CBUSH"):
+			inputType = 3;
+			break;
+		case cardKey("CORD2R"):
+			inputType = 4;
+			break;
+		case cardKey("PBUSH"):
+			inputType = 5;
+			break;
+		case cardKey("PCOMP"):
+			inputType = 6;
+			break;
+		case cardKey("PSHELL"):
+			inputType = 7;
+			break;
+		case cardKey("MAT1"): case cardKey("MAT8"):
+			inputType = 8;
+			break;
+		case cardKey("RBE2"):
+			inputType = 9;
+			break;
+		case cardKey("RBE3"):
+			inputType = 10;
+			break;
+		default:
+			// Card not used by the model
+			return;
+	}
+	if (!pPassProfile.has_card(inputType)) {
+		// Card not in the profile, parseFlag stays false so its continuations are skipped
+		return;
+	}
+	lineEntries.push_back(inputLine);
+	longFormat = lineLongFormat;
+	parseFlag = true;
+}
+
+void BASIC_MODEL::makeEntry(std::vector<BDF_Line> &lineEntries, unsigned int &inputType, bool &longFormat, BDF_Buffer &buffer)
 {
 	switch (inputType) {
 		case 1:
-				CQUAD_Map.insert(std::pair<unsigned long, CQUAD*>(parseElementID(lineEntries[0], longFormat), new CQUAD(lineEntries, longFormat)));
+				if (pRegionPass == 1) {
+					// Region topology pass, only the CQUAD ID, property and corner GRIDs are kept
+					BDF_Tokenizer fields(lineEntries, longFormat);
+					for (int i = 0; i < 6; i++) {
+						buffer.CQUAD_Topology.push_back(fields.field(i).to_long());
+					}
+				} else if (pRegionPass == 0 || pRegion.has_CQUAD(parseElementID(lineEntries[0], longFormat))) {
+					buffer.CQUAD_List.push_back(std::pair<unsigned long, CQUAD*>(parseElementID(lineEntries[0], longFormat), buffer.CQUAD_Arena.create(lineEntries, longFormat)));
+				}
 				lineEntries.clear();
 				inputType = 0;
 			break;
 		case 2:
-				GRID_Map.insert(std::pair<unsigned long, GRID*>(parseElementID(lineEntries[0], longFormat), new GRID(lineEntries, longFormat)));
+				buffer.GRID_List.push_back(std::pair<unsigned long, GRID*>(parseElementID(lineEntries[0], longFormat), buffer.GRID_Arena.create(lineEntries, longFormat)));
 				lineEntries.clear();
 				inputType = 0;
 			break;
 		case 3:
-				CBUSH_Map.insert(std::pair<unsigned long, CBUSH*>(parseElementID(lineEntries[0], longFormat), new CBUSH(lineEntries, longFormat)));
+				buffer.CBUSH_List.push_back(std::pair<unsigned long, CBUSH*>(parseElementID(lineEntries[0], longFormat), buffer.CBUSH_Arena.create(lineEntries, longFormat)));
 				lineEntries.clear();
 				inputType = 0;
 			break;
 		case 4:
-				COORD_Map.insert(std::pair<unsigned long, COORD*>(parseElementID(lineEntries[0], longFormat), new COORD(lineEntries, longFormat)));
+				buffer.COORD_List.push_back(std::pair<unsigned long, COORD*>(parseElementID(lineEntries[0], longFormat), buffer.COORD_Arena.create(lineEntries, longFormat)));
 				lineEntries.clear();
 				inputType = 0;
 			break;
 		case 5:
-				PBUSH_Map.insert(std::pair<unsigned long, PBUSH*>(parseElementID(lineEntries[0], longFormat), new PBUSH(lineEntries, longFormat)));
+				buffer.PBUSH_List.push_back(std::pair<unsigned long, PBUSH*>(parseElementID(lineEntries[0], longFormat), buffer.PBUSH_Arena.create(lineEntries, longFormat)));
 				lineEntries.clear();
 				inputType = 0;
 			break;
 		case 6:
-				PCOMP_Map.insert(std::pair<unsigned long, PCOMP*>(parseElementID(lineEntries[0], longFormat), new PCOMP(lineEntries, longFormat)));
+				if (pRegionPass == 0 || pRegion.has_property(parseElementID(lineEntries[0], longFormat))) {
+					buffer.PCOMP_List.push_back(std::pair<unsigned long, PCOMP*>(parseElementID(lineEntries[0], longFormat), buffer.PCOMP_Arena.create(lineEntries, longFormat)));
+				}
 				lineEntries.clear();
 				inputType = 0;
 			break;
 		case 7:
-				PSHELL_Map.insert(std::pair<unsigned long, PSHELL*>(parseElementID(lineEntries[0], longFormat), new PSHELL(lineEntries, longFormat)));
+				if (pRegionPass == 0 || pRegion.has_property(parseElementID(lineEntries[0], longFormat))) {
+					buffer.PSHELL_List.push_back(std::pair<unsigned long, PSHELL*>(parseElementID(lineEntries[0], longFormat), buffer.PSHELL_Arena.create(lineEntries, longFormat)));
+				}
 				lineEntries.clear();
 				inputType = 0;
 			break;
 		case 8:
-				MAT_Map.insert(std::pair<unsigned long, MAT*>(parseElementID(lineEntries[0], longFormat), new MAT(lineEntries, longFormat)));
+				buffer.MAT_List.push_back(std::pair<unsigned long, MAT*>(parseElementID(lineEntries[0], longFormat), buffer.MAT_Arena.create(lineEntries, longFormat)));
 				lineEntries.clear();
 				inputType = 0;
 			break;
 		case 9:
-				RBE2_Map.insert(std::pair<unsigned long, RBE2*>(parseElementID(lineEntries[0], longFormat), new RBE2(lineEntries, longFormat)));
+				buffer.RBE2_List.push_back(std::pair<unsigned long, RBE2*>(parseElementID(lineEntries[0], longFormat), buffer.RBE2_Arena.create(lineEntries, longFormat)));
 				lineEntries.clear();
 				inputType = 0;
 			break;
 		case 10:
-				RBE3_Map.insert(std::pair<unsigned long, RBE3*>(parseElementID(lineEntries[0], longFormat), new RBE3(lineEntries, longFormat)));
+				buffer.RBE3_List.push_back(std::pair<unsigned long, RBE3*>(parseElementID(lineEntries[0], longFormat), buffer.RBE3_Arena.create(lineEntries, longFormat)));
 				lineEntries.clear();
 				inputType = 0;
 			break;
 	}
 }
 
-unsigned long BASIC_MODEL::parseElementID(std::string &inputLine, bool &longFormat)
+unsigned long BASIC_MODEL::parseElementID(BDF_Line &inputLine, bool &longFormat)
 {
 	//std::string tempString;
 	if (longFormat) {
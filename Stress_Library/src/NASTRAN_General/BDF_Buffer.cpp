@@ -0,0 +1,43 @@
+/**
+ *
+ * @file		BDF_Buffer.cpp
+ * @author		Matt Guimarey
+ * @date		17/10/2026
+ * @version		1.0
+ *
+ * This class defines a buffer of the cards parsed from a single Bulk Data File
+ *
+ */
+
+#include "NASTRAN_General/BDF_Buffer.h"
+#include "NASTRAN_General/CQUAD.h"
+#include "NASTRAN_General/GRID.h"
+#include "NASTRAN_General/CBUSH.h"
+#include "NASTRAN_General/COORD.h"
+#include "NASTRAN_General/PBUSH.h"
+#include "NASTRAN_General/PCOMP.h"
+#include "NASTRAN_General/PSHELL.h"
+#include "NASTRAN_General/MAT.h"
+#include "NASTRAN_General/RBE2.h"
+#include "NASTRAN_General/RBE3.h"
+
+#include <string>
+#include <vector>
+#include <utility>
+
+BDF_Buffer::BDF_Buffer()
+{
+	opened = false;
+}
+
+BDF_Buffer::BDF_Buffer(std::string FileName)
+{
+	fileName = FileName;
+	opened = false;
+}
+
+BDF_Buffer::~BDF_Buffer()
+{
+	for (int i = 0; i < chunks.size(); i++) { delete chunks[i]; }
+	for (int i = 0; i < includes.size(); i++) { delete includes[i]; }
+}
@@ -0,0 +1,271 @@
+/**
+ *
+ * @file		BDF_Field.cpp
+ * @author		Matt Guimarey
+ * @date		17/10/2026
+ * @version		1.0
+ *
+ * This class defines a non-owning view of a single fixed width Bulk Data File field
+ *
+ */
+
+#include "NASTRAN_General/BDF_Field.h"
+
+#include <string>
+#include <cstring>
+#include <cstdlib>
+#include <cctype>
+
+#define FIELD_BUFFER_SIZE 64
+
+BDF_Field::BDF_Field()
+{
+	pData = NULL;
+	pLength = 0;
+}
+
+BDF_Field::BDF_Field(const char* Data, std::size_t Length)
+{
+	// Trim leading and trailing blanks
+	std::size_t first = 0;
+	while (first < Length && Data[first] == ' ') {
+		first++;
+	}
+	std::size_t last = Length;
+	while (last > first && Data[last - 1] == ' ') {
+		last--;
+	}
+	pData = Data + first;
+	pLength = last - first;
+}
+
+BDF_Field::BDF_Field(const std::string &Data)
+{
+	*this = BDF_Field(Data.data(), Data.size());
+}
+
+BDF_Field::~BDF_Field()
+{
+
+}
+
+bool BDF_Field::is_blank() const
+{
+	return pLength == 0;
+}
+
+bool BDF_Field::is_real() const
+{
+	return pLength > 0 && memchr(pData, '.', pLength) != NULL;
+}
+
+bool BDF_Field::compare(const char* text) const
+{
+	return strlen(text) == pLength && (pLength == 0 || memcmp(pData, text, pLength) == 0);
+}
+
+/**
+ *	@brief	Converts the field to an integer. Matches atol, leading white space is skipped,
+ *			an optional sign is read and the conversion stops at the first non-digit.
+ *
+ *	@return	long, the integer value, 0 if the field is blank or not a number
+ */
+
+long BDF_Field::to_long() const
+{
+	std::size_t i = 0;
+	while (i < pLength && isspace((unsigned char)pData[i])) {
+		i++;
+	}
+	bool negative = false;
+	if (i < pLength && (pData[i] == '-' || pData[i] == '+')) {
+		negative = pData[i] == '-';
+		i++;
+	}
+	long value = 0;
+	while (i < pLength && pData[i] >= '0' && pData[i] <= '9') {
+		value = value * 10 + (pData[i] - '0');
+		i++;
+	}
+	return negative ? -value : value;
+}
+
+/**
+ *	@brief	Converts the field to a real. NASTRAN allows the 'E' of an exponent to be
+ *			omitted ('1.5-3', '.5+2'), these are read as if the 'E' was present. Fields of
+ *			the form [sign]digits[.digits][E|e][sign]digits are decoded directly, any other
+ *			field is passed to atof after the exponent has been restored. Either way the
+ *			result is identical to atof on the field with the 'E' inserted.
+ *
+ *	@return	double, the real value, 0.0 if the field is blank or not a number
+ */
+
+double BDF_Field::to_double() const
+{
+	if (pLength == 0) {
+		return 0.0;
+	}
+	double value;
+	if (decode_real(value)) {
+		return value;
+	}
+	return convert_real();
+}
+
+/**
+ *	@brief	Decodes a real without calling the C library. The mantissa is read as an integer
+ *			and scaled by an exact power of ten, when the mantissa is below 2^53 and the power
+ *			is at most 10^22 both are exact doubles and the single multiply or divide rounds
+ *			correctly, giving the same double as strtod. Fields outside these limits or not
+ *			matching the real number pattern are rejected for convert_real to handle.
+ *
+ *	@param	value, set to the decoded real
+ *	@return	bool, true if the field was decoded
+ */
+
+bool BDF_Field::decode_real(double &value) const
+{
+	static const double powers[23] = {1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+		1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+	std::size_t i = 0;
+	bool negative = false;
+	if (pData[i] == '-' || pData[i] == '+') {
+		negative = pData[i] == '-';
+		i++;
+	}
+	// Mantissa digits, leading zeros are not significant
+	unsigned long long mantissa = 0;
+	int digits = 0, significant = 0, decimals = 0;
+	bool point = false;
+	for (; i < pLength; i++) {
+		char c = pData[i];
+		if (c >= '0' && c <= '9') {
+			digits++;
+			if (point) {
+				decimals++;
+			}
+			if (mantissa != 0 || c != '0') {
+				if (++significant > 16) {
+					return false;
+				}
+				mantissa = mantissa * 10 + (c - '0');
+			}
+		} else if (c == '.' && !point) {
+			point = true;
+		} else {
+			break;
+		}
+	}
+	if (digits == 0) {
+		return false;
+	}
+	// Exponent, with or without the 'E'
+	int exponent = 0;
+	if (i < pLength) {
+		if (pData[i] == 'E' || pData[i] == 'e') {
+			i++;
+		}
+		bool negativeExp = false;
+		if (i < pLength && (pData[i] == '-' || pData[i] == '+')) {
+			negativeExp = pData[i] == '-';
+			i++;
+		} else if (pData[i - 1] != 'E' && pData[i - 1] != 'e') {
+			return false;
+		}
+		if (i == pLength) {
+			return false;
+		}
+		for (; i < pLength; i++) {
+			if (pData[i] < '0' || pData[i] > '9' || exponent > 1000) {
+				return false;
+			}
+			exponent = exponent * 10 + (pData[i] - '0');
+		}
+		if (negativeExp) {
+			exponent = -exponent;
+		}
+	}
+	if (mantissa == 0) {
+		value = negative ? -0.0 : 0.0;
+		return true;
+	}
+	exponent -= decimals;
+	if (mantissa > 9007199254740992ULL || exponent < -22 || exponent > 22) {
+		return false;
+	}
+	value = (double)mantissa;
+	if (exponent < 0) {
+		value /= powers[-exponent];
+	} else {
+		value *= powers[exponent];
+	}
+	if (negative) {
+		value = -value;
+	}
+	return true;
+}
+
+/**
+ *	@brief	Converts the field with atof. If a sign is found after the first character and
+ *			the field has no 'E' or 'e' one is inserted before the sign (minus takes
+ *			precedence over plus). The field is copied to a stack buffer, no heap allocation.
+ *
+ *	@return	double, the real value
+ */
+
+double BDF_Field::convert_real() const
+{
+	// Find an implied exponent sign, minus takes precedence over plus
+	std::size_t exp = 0;
+	for (std::size_t i = 1; i < pLength; i++) {
+		if (pData[i] == '-') {
+			exp = i;
+			break;
+		}
+	}
+	if (exp == 0) {
+		for (std::size_t i = 1; i < pLength; i++) {
+			if (pData[i] == '+') {
+				exp = i;
+				break;
+			}
+		}
+	}
+	if (exp != 0 && (memchr(pData, 'E', pLength) != NULL || memchr(pData, 'e', pLength) != NULL)) {
+		exp = 0;
+	}
+	if (pLength + 2 > FIELD_BUFFER_SIZE) {
+		// Longer than any fixed width field, convert through a string
+		std::string tempStr = str();
+		if (exp != 0) {
+			tempStr.insert(exp, "E");
+		}
+		return atof(tempStr.c_str());
+	}
+	char buffer[FIELD_BUFFER_SIZE];
+	if (exp == 0) {
+		memcpy(buffer, pData, pLength);
+		buffer[pLength] = 0;
+	} else {
+		memcpy(buffer, pData, exp);
+		buffer[exp] = 'E';
+		memcpy(buffer + exp + 1, pData + exp, pLength - exp);
+		buffer[pLength + 1] = 0;
+	}
+	return atof(buffer);
+}
+
+std::string BDF_Field::str() const
+{
+	return std::string(pData, pLength);
+}
+
+const char* BDF_Field::data() const
+{
+	return pData;
+}
+
+std::size_t BDF_Field::length() const
+{
+	return pLength;
+}
@@ -0,0 +1,130 @@
+/**
+ *
+ * @file		BDF_Line.cpp
+ * @author		Matt Guimarey
+ * @date		17/10/2026
+ * @version		1.0
+ *
+ * This class defines a non-owning view of a single Bulk Data File line
+ *
+ */
+
+#include "NASTRAN_General/BDF_Line.h"
+
+#include <string>
+#include <cstring>
+
+BDF_Line::BDF_Line()
+{
+	pData = NULL;
+	pLength = 0;
+}
+
+BDF_Line::BDF_Line(const char* Data, std::size_t Length)
+{
+	pData = Data;
+	pLength = Length;
+}
+
+BDF_Line::~BDF_Line()
+{
+
+}
+
+/**
+ *	@brief	Returns a view of the line starting at cursor and moves the cursor to the start
+ *			of the following line. The returned view excludes the '\n' and any '\r' before it.
+ *
+ *	@param	cursor, a pointer into the file buffer, advanced past the line
+ *	@param	end, a pointer one past the end of the file buffer
+ *	@return	BDF_Line, view of the line
+ */
+
+BDF_Line BDF_Line::next_line(const char* &cursor, const char* end)
+{
+	const char* start = cursor;
+	const char* newline = (const char*)memchr(start, '\n', end - start);
+	const char* stop;
+	if (newline == NULL) {
+		stop = end;
+		cursor = end;
+	} else {
+		stop = newline;
+		cursor = newline + 1;
+	}
+	if (stop > start && *(stop - 1) == '\r') {
+		stop--;
+	}
+	return BDF_Line(start, stop - start);
+}
+
+/**
+ *	@brief	Returns a string copy of a range of columns. Columns past the end of the line
+ *			are returned as blanks, matching a line padded to 80 characters.
+ *
+ *	@param	pos, the first column
+ *	@param	len, the number of columns
+ *	@return	std::string, the column range
+ */
+
+std::string BDF_Line::substr(std::size_t pos, std::size_t len) const
+{
+	std::string returnString(len, ' ');
+	for (std::size_t i = 0; i < len && pos + i < pLength; i++) {
+		returnString[i] = pData[pos + i];
+	}
+	return returnString;
+}
+
+/**
+ *	@brief	Compares a range of columns to a string without copying the line. The text is
+ *			treated as blank padded to len characters.
+ *
+ *	@param	pos, the first column
+ *	@param	len, the number of columns
+ *	@param	text, a null terminated string to compare against
+ *	@return	bool, true if the columns match
+ */
+
+bool BDF_Line::compare_field(std::size_t pos, std::size_t len, const char* text) const
+{
+	bool textEnd = false;
+	for (std::size_t i = 0; i < len; i++) {
+		char textChar = ' ';
+		if (!textEnd) {
+			if (text[i] == 0) {
+				textEnd = true;
+			} else {
+				textChar = text[i];
+			}
+		}
+		if ((*this)[pos + i] != textChar) {
+			return false;
+		}
+	}
+	return true;
+}
+
+bool BDF_Line::is_continuation() const
+{
+	char first = (*this)[0];
+	if (first != ' ' && first != '*') {
+		return false;
+	}
+	for (std::size_t i = 1; i < 8; i++) {
+		if ((*this)[i] != ' ') {
+			return false;
+		}
+	}
+	return true;
+}
+
+const char* BDF_Line::data() const
+{
+	return pData;
+}
+
+std::size_t BDF_Line::length() const
+{
+	return pLength;
+}
@@ -0,0 +1,91 @@
+/**
+ *
+ * @file		BDF_Profile.cpp
+ * @author		Matt Guimarey
+ * @date		17/10/2026
+ * @version		1.0
+ *
+ * This class defines the set of card types loaded from a Bulk Data File
+ *
+ */
+
+#include "NASTRAN_General/BDF_Profile.h"
+
+#include <string>
+
+#define PROFILE_FULL			0x7FE	// Card types 1 -> 10
+#define PROFILE_FH				0x7DE	// Card types 1 -> 10 except 5 (PBUSH)
+#define PROFILE_PULL_THROUGH	0x7FE	// FH and PBUSH
+
+BDF_Profile::BDF_Profile()
+{
+	pCards = PROFILE_FULL;
+}
+
+BDF_Profile::~BDF_Profile()
+{
+
+}
+
+/**
+ *	@brief	Returns the card type bits of a named profile or a single card type.
+ *
+ *	@param	name, a profile name (FULL, FH, PULL_THROUGH) or a card name
+ *	@return	unsigned int, the card type bits, 0 if the name is not recognised
+ */
+
+static unsigned int profileCards(std::string &name)
+{
+	if (name.compare("FULL") == 0) {
+		return PROFILE_FULL;
+	} else if (name.compare("FH") == 0) {
+		return PROFILE_FH;
+	} else if (name.compare("PULL_THROUGH") == 0) {
+		return PROFILE_PULL_THROUGH;
+	} else if (name.compare("CQUAD4") == 0) {
+		return 1u << 1;
+	} else if (name.compare("GRID") == 0) {
+		return 1u << 2;
+	} else if (name.compare("CBUSH") == 0) {
+		return 1u << 3;
+	} else if (name.compare("CORD2R") == 0) {
+		return 1u << 4;
+	} else if (name.compare("PBUSH") == 0) {
+		return 1u << 5;
+	} else if (name.compare("PCOMP") == 0) {
+		return 1u << 6;
+	} else if (name.compare("PSHELL") == 0) {
+		return 1u << 7;
+	} else if (name.compare("MAT1") == 0 || name.compare("MAT8") == 0) {
+		return 1u << 8;
+	} else if (name.compare("RBE2") == 0) {
+		return 1u << 9;
+	} else if (name.compare("RBE3") == 0) {
+		return 1u << 10;
+	}
+	return 0;
+}
+
+bool BDF_Profile::add(std::string name)
+{
+	unsigned int cards = profileCards(name);
+	pCards |= cards;
+	return cards != 0;
+}
+
+bool BDF_Profile::remove(std::string name)
+{
+	unsigned int cards = profileCards(name);
+	pCards &= ~cards;
+	return cards != 0;
+}
+
+void BDF_Profile::clear()
+{
+	pCards = 0;
+}
+
+bool BDF_Profile::is_empty() const
+{
+	return pCards == 0;
+}
@@ -0,0 +1,247 @@
+/**
+ *
+ * @file		BDF_Region.cpp
+ * @author		Matt Guimarey
+ * @date		17/10/2026
+ * @version		1.0
+ *
+ * This class defines a region of interest of a model around selected fastener nodes
+ *
+ */
+
+#include "NASTRAN_General/BDF_Region.h"
+#include "NASTRAN_General/GRID.h"
+#include "NASTRAN_General/COORD.h"
+#include "NASTRAN_General/RBE2.h"
+#include "NASTRAN_General/RBE3.h"
+#include "Math/Coordinate.h"
+
+#include <vector>
+#include <map>
+#include <utility>
+#include <algorithm>
+
+#define TOPOLOGY_SIZE 6		// Topology entries per CQUAD: ID, Property ID, GRID 1 -> GRID 4
+#define RIGID_LEVELS 2		// RBE levels followed from a fastener node, RBE2 to the plate then an RBE3 spider
+
+static bool sort_node_x(const std::pair<double, Coordinate> &first_node, const std::pair<double, Coordinate> &second_node)
+{
+	return first_node.first < second_node.first;
+}
+
+static bool node_before_x(const std::pair<double, Coordinate> &node, double x)
+{
+	return node.first < x;
+}
+
+BDF_Region::BDF_Region()
+{
+	pRings = 1;
+	pDistance = 0.0;
+}
+
+BDF_Region::~BDF_Region()
+{
+
+}
+
+void BDF_Region::add_node(unsigned long GridID)
+{
+	pNodes.push_back(GridID);
+}
+
+void BDF_Region::set_rings(int Rings)
+{
+	pRings = Rings;
+	pDistance = 0.0;
+}
+
+void BDF_Region::set_distance(double Distance)
+{
+	pDistance = Distance;
+}
+
+bool BDF_Region::is_empty() const
+{
+	return pNodes.empty();
+}
+
+void BDF_Region::add_topology(std::vector<unsigned long> &Topology)
+{
+	pTopology.insert(pTopology.end(), Topology.begin(), Topology.end());
+	Topology.clear();
+}
+
+/**
+ *	@brief	Selects the CQUADs inside the region. For a ring region the CQUADs connected to
+ *			the fastener nodes form the first ring and each further ring is the CQUADs
+ *			connected to the corner GRIDs of the last, matching the iterations of the FH
+ *			search. For a distance region a CQUAD is kept if any corner GRID lies within
+ *			the distance of a fastener node.
+ *
+ *	@param	GRID_Map, a map of all the GRIDs present in the model
+ *	@param	RBE2_Map, a map of all the RBE2 elements present in the model
+ *	@param	RBE3_Map, a map of all the RBE3 elements present in the model
+ *	@param	COORD_Map, a map of all the coordinate systems present in the model
+ *	@return	void
+ */
+
+void BDF_Region::select(std::map<unsigned long, GRID*> &GRID_Map, std::map<unsigned long, RBE2*> &RBE2_Map,
+		std::map<unsigned long, RBE3*> &RBE3_Map, std::map<unsigned long, COORD*> &COORD_Map)
+{
+	std::size_t count = pTopology.size() / TOPOLOGY_SIZE;
+	std::vector<bool> selected(count, false);
+	//	Fastener nodes and the nodes of the RBEs connecting them to the plate
+	std::vector<unsigned long> grids = pNodes;
+	std::sort(grids.begin(), grids.end());
+	grids.erase(std::unique(grids.begin(), grids.end()), grids.end());
+	add_rigid_nodes(grids, GRID_Map, RBE2_Map, RBE3_Map);
+	if (pDistance > 0.0) {
+		//	Fastener node coordinates sorted by x, GRIDs are only checked against nodes inside the x band
+		std::vector<std::pair<double, Coordinate> > nodes;
+		for (int i = 0; i < grids.size(); i++) {
+			std::map<unsigned long, GRID*>::iterator Grid_it = GRID_Map.find(grids[i]);
+			if (Grid_it != GRID_Map.end()) {
+				Coordinate point = Grid_it->second->get_coordinate(0, COORD_Map);
+				nodes.push_back(std::pair<double, Coordinate>(point[0], point));
+			}
+		}
+		std::sort(nodes.begin(), nodes.end(), sort_node_x);
+		//	GRIDs inside the region, GRID map order keeps the IDs sorted
+		std::vector<unsigned long> inside;
+		double limit = pDistance * pDistance;
+		for (std::map<unsigned long, GRID*>::iterator Grid_it = GRID_Map.begin(); Grid_it != GRID_Map.end(); Grid_it++) {
+			Coordinate point = Grid_it->second->get_coordinate(0, COORD_Map);
+			std::vector<std::pair<double, Coordinate> >::iterator node_it = std::lower_bound(nodes.begin(), nodes.end(), point[0] - pDistance, node_before_x);
+			for (; node_it != nodes.end() && node_it->first <= point[0] + pDistance; node_it++) {
+				double dx = point[0] - node_it->second[0];
+				double dy = point[1] - node_it->second[1];
+				double dz = point[2] - node_it->second[2];
+				if (dx * dx + dy * dy + dz * dz <= limit) {
+					inside.push_back(Grid_it->first);
+					break;
+				}
+			}
+		}
+		for (std::size_t q = 0; q < count; q++) {
+			for (int k = 2; k < TOPOLOGY_SIZE; k++) {
+				if (std::binary_search(inside.begin(), inside.end(), pTopology[q * TOPOLOGY_SIZE + k])) {
+					selected[q] = true;
+					break;
+				}
+			}
+		}
+	} else {
+		//	Index of the CQUADs connected to each GRID
+		std::vector<std::pair<unsigned long, std::size_t> > gridIndex;
+		gridIndex.reserve(count * 4);
+		for (std::size_t q = 0; q < count; q++) {
+			for (int k = 2; k < TOPOLOGY_SIZE; k++) {
+				gridIndex.push_back(std::pair<unsigned long, std::size_t>(pTopology[q * TOPOLOGY_SIZE + k], q));
+			}
+		}
+		std::sort(gridIndex.begin(), gridIndex.end());
+		for (int ring = 0; ring < pRings; ring++) {
+			std::vector<unsigned long> nextGrids;
+			for (int i = 0; i < grids.size(); i++) {
+				std::vector<std::pair<unsigned long, std::size_t> >::iterator index_it = std::lower_bound(gridIndex.begin(), gridIndex.end(),
+						std::pair<unsigned long, std::size_t>(grids[i], 0));
+				for (; index_it != gridIndex.end() && index_it->first == grids[i]; index_it++) {
+					std::size_t q = index_it->second;
+					if (!selected[q]) {
+						selected[q] = true;
+						for (int k = 2; k < TOPOLOGY_SIZE; k++) {
+							nextGrids.push_back(pTopology[q * TOPOLOGY_SIZE + k]);
+						}
+					}
+				}
+			}
+			std::sort(nextGrids.begin(), nextGrids.end());
+			nextGrids.erase(std::unique(nextGrids.begin(), nextGrids.end()), nextGrids.end());
+			grids.swap(nextGrids);
+		}
+	}
+	pCQUADs.clear();
+	pProperties.clear();
+	for (std::size_t q = 0; q < count; q++) {
+		if (selected[q]) {
+			pCQUADs.push_back(pTopology[q * TOPOLOGY_SIZE]);
+			pProperties.push_back(pTopology[q * TOPOLOGY_SIZE + 1]);
+		}
+	}
+	std::sort(pCQUADs.begin(), pCQUADs.end());
+	pCQUADs.erase(std::unique(pCQUADs.begin(), pCQUADs.end()), pCQUADs.end());
+	std::sort(pProperties.begin(), pProperties.end());
+	pProperties.erase(std::unique(pProperties.begin(), pProperties.end()), pProperties.end());
+	//	Topology is no longer needed
+	std::vector<unsigned long>().swap(pTopology);
+}
+
+bool BDF_Region::has_CQUAD(unsigned long ElementID) const
+{
+	return std::binary_search(pCQUADs.begin(), pCQUADs.end(), ElementID);
+}
+
+bool BDF_Region::has_property(unsigned long PropertyID) const
+{
+	return std::binary_search(pProperties.begin(), pProperties.end(), PropertyID);
+}
+
+std::size_t BDF_Region::topology_size() const
+{
+	return pTopology.size() / TOPOLOGY_SIZE;
+}
+
+std::size_t BDF_Region::CQUAD_size() const
+{
+	return pCQUADs.size();
+}
+
+/**
+ *	@brief	Adds the independent and dependent nodes of the RBE2 and RBE3 elements connected
+ *			to the seed GRIDs, following fasteners that are spidered onto the plate rather
+ *			than sharing a plate GRID.
+ *
+ *	@param	Seeds, a sorted vector of GRID IDs, extended and kept sorted on return
+ *	@param	GRID_Map, a map of all the GRIDs present in the model
+ *	@param	RBE2_Map, a map of all the RBE2 elements present in the model
+ *	@param	RBE3_Map, a map of all the RBE3 elements present in the model
+ *	@return	void
+ */
+
+void BDF_Region::add_rigid_nodes(std::vector<unsigned long> &Seeds, std::map<unsigned long, GRID*> &GRID_Map,
+		std::map<unsigned long, RBE2*> &RBE2_Map, std::map<unsigned long, RBE3*> &RBE3_Map)
+{
+	for (int level = 0; level < RIGID_LEVELS; level++) {
+		std::vector<unsigned long> added;
+		for (int i = 0; i < Seeds.size(); i++) {
+			std::map<unsigned long, GRID*>::iterator Grid_it = GRID_Map.find(Seeds[i]);
+			if (Grid_it == GRID_Map.end()) {
+				continue;
+			}
+			std::vector<unsigned long> RBE_List = Grid_it->second->getRBE2_List();
+			for (int k = 0; k < RBE_List.size(); k++) {
+				std::map<unsigned long, RBE2*>::iterator RBE2_it = RBE2_Map.find(RBE_List[k]);
+				if (RBE2_it != RBE2_Map.end()) {
+					added.push_back((*RBE2_it->second)[1]);
+					for (int z = 3; z < (3 + RBE2_it->second->get_num_dependant_nodes()); z++) {
+						added.push_back((*RBE2_it->second)[z]);
+					}
+				}
+			}
+			RBE_List = Grid_it->second->getRBE3_List();
+			for (int k = 0; k < RBE_List.size(); k++) {
+				std::map<unsigned long, RBE3*>::iterator RBE3_it = RBE3_Map.find(RBE_List[k]);
+				if (RBE3_it != RBE3_Map.end()) {
+					added.push_back((*RBE3_it->second)[1]);
+					for (int z = 3; z < (3 + RBE3_it->second->get_num_independant_nodes()); z++) {
+						added.push_back((*RBE3_it->second)[z]);
+					}
+				}
+			}
+		}
+		Seeds.insert(Seeds.end(), added.begin(), added.end());
+		std::sort(Seeds.begin(), Seeds.end());
+		Seeds.erase(std::unique(Seeds.begin(), Seeds.end()), Seeds.end());
+	}
+}
@@ -0,0 +1,35 @@
+/**
+ *
+ * @file		BDF_Source.cpp
+ * @author		Matt Guimarey
+ * @date		17/10/2026
+ * @version		1.0
+ *
+ * This class records the cards a single Bulk Data File contributed to a model
+ *
+ */
+
+#include "NASTRAN_General/BDF_Source.h"
+
+#include <string>
+#include <vector>
+
+BDF_Source::BDF_Source()
+{
+	hashed = false;
+	size = 0;
+	hash = 0;
+}
+
+BDF_Source::BDF_Source(std::string FileName)
+{
+	fileName = FileName;
+	hashed = false;
+	size = 0;
+	hash = 0;
+}
+
+BDF_Source::~BDF_Source()
+{
+
+}
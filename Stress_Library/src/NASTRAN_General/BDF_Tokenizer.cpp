@@ -0,0 +1,79 @@
+/**
+ *
+ * @file		BDF_Tokenizer.cpp
+ * @author		Matt Guimarey
+ * @date		17/10/2026
+ * @version		1.0
+ *
+ * This class splits the lines of a Bulk Data File card into fixed width fields
+ *
+ */
+
+#include "NASTRAN_General/BDF_Tokenizer.h"
+#include "NASTRAN_General/BDF_Line.h"
+#include "NASTRAN_General/BDF_Field.h"
+
+#include <vector>
+
+#define BDF_NAME_WIDTH 8
+
+BDF_Tokenizer::BDF_Tokenizer(const std::vector<BDF_Line> &Lines, bool LongFormat)
+{
+	pLines = &Lines;
+	if (LongFormat) {
+		pWidth = 16;
+		pFieldsPerLine = 4;
+	} else {
+		pWidth = 8;
+		pFieldsPerLine = 8;
+	}
+}
+
+BDF_Tokenizer::~BDF_Tokenizer()
+{
+
+}
+
+/**
+ *	@brief	Returns a view of a data field. The field's line and columns are calculated
+ *			directly from its index, columns past the end of a short line are blank.
+ *
+ *	@param	i, the data field index, 0 is the field following the card name
+ *	@return	BDF_Field, view of the field
+ */
+
+BDF_Field BDF_Tokenizer::field(std::size_t i) const
+{
+	std::size_t line = i / pFieldsPerLine;
+	if (line >= pLines->size()) {
+		return BDF_Field();
+	}
+	const BDF_Line &lineData = (*pLines)[line];
+	std::size_t start = BDF_NAME_WIDTH + (i % pFieldsPerLine) * pWidth;
+	if (start >= lineData.length()) {
+		return BDF_Field();
+	}
+	std::size_t length = lineData.length() - start;
+	if (length > pWidth) {
+		length = pWidth;
+	}
+	return BDF_Field(lineData.data() + start, length);
+}
+
+BDF_Field BDF_Tokenizer::name() const
+{
+	if (pLines->empty()) {
+		return BDF_Field();
+	}
+	const BDF_Line &lineData = (*pLines)[0];
+	std::size_t length = lineData.length();
+	if (length > BDF_NAME_WIDTH) {
+		length = BDF_NAME_WIDTH;
+	}
+	return BDF_Field(lineData.data(), length);
+}
+
+std::size_t BDF_Tokenizer::size() const
+{
+	return pLines->size() * pFieldsPerLine;
+}
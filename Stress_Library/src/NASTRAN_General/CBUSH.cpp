@@ -19,6 +19,12 @@
 #include "Math/Transformation.h"
 #include "Math/Coordinate.h"
 #include "Math/Euclidean_Vector.h"
+#include "NASTRAN_General/BDF_Line.h"
+#include "NASTRAN_General/BDF_Tokenizer.h"
+#include "NASTRAN_General/BDF_Field.h"
+#include "NASTRAN_General/Result_Store.h"
+#include "IO/Binary_Writer.h"
+#include "IO/Binary_Reader.h"
 
 
 #include <iostream>
@@ -35,24 +41,32 @@ CBUSH::CBUSH()
 	pOrienType = 0;
 	pTransFlag = false;
 	pNodeSort = false;
+	pResults = NULL;
+	pResultIndex = 0;
 }
 
 /**
  *	@brief	Constructor also parsing Bulk Data File data, runs parse_BDF_data
  *
- *	@param	BDF_Data, a string vector containing Bulk Data File input lines
+ *	@param	BDF_Data, a BDF_Line vector of the Bulk Data File input lines
  * 	@param 	LongFormatFlag, a boolean flagging format type
  */
 
-CBUSH::CBUSH(std::vector<std::string> BDF_Data, bool LongFormatFlag)
+CBUSH::CBUSH(std::vector<BDF_Line> &BDF_Data, bool LongFormatFlag)
 {
 	pOrienType = 0;
+	pTransFlag = false;
+	pNodeSort = false;
+	pResults = NULL;
+	pResultIndex = 0;
 	parseBDFData(BDF_Data, LongFormatFlag);
 }
 
 CBUSH::CBUSH(unsigned long ElementID)
 {
 	pLongData[0] = ElementID;
+	pResults = NULL;
+	pResultIndex = 0;
 }
 
 CBUSH::~CBUSH()
@@ -65,68 +79,47 @@ CBUSH::~CBUSH()
 			File has a short and a long format recognised by NASTRAN, the flag 
 			modifies how the input data is parsed for these occurences.
  *
- *	@param	BDF_Data, a string vector containing Bulk Data File input lines
+ *	@param	BDF_Data, a BDF_Line vector of the Bulk Data File input lines
  * 	@param 	LongFormatFlag, a boolean flagging format type
  *	@return	void
  */
 
-void CBUSH::parseBDFData(std::vector<std::string> BDF_Data, bool LongFormatFlag)
+void CBUSH::parseBDFData(std::vector<BDF_Line> &BDF_Data, bool LongFormatFlag)
 {
-	std::vector<std::string> LineData;	///< String vector to store seperated line entries for parsing
-	std::string str(80, ' ');
-	if (!LongFormatFlag) {
-		// Short Format, data fields every 8 characters (80 chars max)
-		while (BDF_Data.size() < 2) {
-			BDF_Data.push_back(str);
-		}
-		for (int i = 0; i < BDF_Data.size(); i++) {
-			for (int j = 8; j < 72; j += 8) {
-				LineData.push_back(BDF_Data[i].substr(j, 8));
-			}
-		}
-	} else {
-		// Long Format, data fields every 16 characters after inital 8 characters (80 chars max)
-		while (BDF_Data.size() < 4) {
-			BDF_Data.push_back(str);
-		}
-		for (int i = 0; i< BDF_Data.size(); i++) {
-			for (int j = 8; j < 72; j += 16) {
-				LineData.push_back(BDF_Data[i].substr(j, 16));
-			}
-		}
-	}
+	// Split the card into fixed width fields, no data is copied
+	BDF_Tokenizer fields(BDF_Data, LongFormatFlag);
 	//	Parse Longs - Element ID to GRID B
-	for (int i = 0; i < 4; i++) { pLongData[i] = atol(LineData[i].c_str()); }
+	for (int i = 0; i < 4; i++) { pLongData[i] = fields.field(i).to_long(); }
 	// Parse Orientation
-	str = check_exp(LineData[4]);
-	if (str.compare("") == 0) {
+	BDF_Field field = fields.field(4);
+	if (field.is_blank()) {
 		// Orientation by CID
 		pOrienType = 3;
-		pLongData[5] = atol(LineData[7].c_str());
-	} else if (!checkReal(str)) {
+		pLongData[5] = fields.field(7).to_long();
+	} else if (!field.is_real()) {
 		// Orientation by GO
 		pOrienType = 1;
-		pLongData[4] = atol(str.c_str());
+		pLongData[4] = field.to_long();
 	} else {
 		// Orientation by Coordinates
 		pOrienType = 2;
-		pCoordinate[0].set_coordinates(atof(str.c_str()), atof(check_exp(LineData[5]).c_str()), atof(check_exp(LineData[6]).c_str()));
+		pCoordinate[0].set_coordinates(field.to_double(), fields.field(5).to_double(), fields.field(6).to_double());
 	}
 	//	S value
-	str = check_exp(LineData[8]);
-	if (str.compare("") == 0) {
+	field = fields.field(8);
+	if (field.is_blank()) {
 		pS = 0.5;
 	} else {
-		pS = atof(str.c_str());
+		pS = field.to_double();
 	}
 	//	OCID
-	str = check_exp(LineData[9]);
-	if (str.compare("") == 0 || str.compare("-1") == 0) {
+	field = fields.field(9);
+	if (field.is_blank() || field.compare("-1")) {
 		pLongData[6] = -1;
 		pCoordinate[1].set_coordinates(0.0, 0.0, 0.0);
 	} else {
-		pLongData[6] = atol(str.c_str());
-		pCoordinate[1].set_coordinates(atof(check_exp(LineData[10]).c_str()), atof(check_exp(LineData[11]).c_str()), atof(check_exp(LineData[12]).c_str()));
+		pLongData[6] = field.to_long();
+		pCoordinate[1].set_coordinates(fields.field(10).to_double(), fields.field(11).to_double(), fields.field(12).to_double());
 	}
 }
 
@@ -177,8 +170,9 @@ Euclidean_Vector CBUSH::get_vector(unsigned int axis, unsigned long COORD_ID, st
 		Coordinate fastener_coords[2];
 		Euclidean_Vector fast_vector(0.0, 0.0, 1.0);
 		for (int i = 0; i < 2; i++) {
-			if (GRID_Map.find(fastenerNodes[i]) != GRID_Map.end()) {
-				fastener_coords[i] = GRID_Map[fastenerNodes[i]]->get_coordinate(COORD_ID, COORD_Map);
+			std::map<unsigned long, GRID*>::iterator GRID_it = GRID_Map.find(fastenerNodes[i]);
+			if (GRID_it != GRID_Map.end()) {
+				fastener_coords[i] = GRID_it->second->get_coordinate(COORD_ID, COORD_Map);
 			} else {
 				//	Error finding fastener node in model...
 				return fast_vector;
@@ -196,8 +190,9 @@ Euclidean_Vector CBUSH::get_vector(unsigned int axis, unsigned long COORD_ID, st
 			//	TODO
 			break;
 		default:	
-			if (COORD_Map.find(pLongData[5]) != COORD_Map.end()) {
-				return COORD_Map[pLongData[5]]->get_axis_vector(axis, false, COORD_ID, COORD_Map);
+			std::map<unsigned long, COORD*>::iterator COORD_it = COORD_Map.find(pLongData[5]);
+			if (COORD_it != COORD_Map.end()) {
+				return COORD_it->second->get_axis_vector(axis, false, COORD_ID, COORD_Map);
 			} else {
 				//	COORD System ID not found in model, set CBUSH vectors to GLOABL
 				Euclidean_Vector global_vector;
@@ -243,6 +238,7 @@ void CBUSH::parse_FH(std::map<unsigned long, GRID*> &GRID_Map, std::map<unsigned
 {
 	std::vector<unsigned long> QUAD_Vector;		///< A vector to store the CQUAD IDs of current iteration
 	std::vector<unsigned long> GRID_Vector;		///< A vector to store GRID IDs of next iteration
+	std::map<unsigned long, GRID*>::iterator GRID_it;
 	// Fastener Node A -> 0 and Fastener Node B -> 1
 	//	Start process by adding initial fastener node to the GRID_Vector
 	if (GRID_Map.find(fastenerNodes[side_no]) != GRID_Map.end()) {
@@ -252,8 +248,9 @@ void CBUSH::parse_FH(std::map<unsigned long, GRID*> &GRID_Map, std::map<unsigned
 		while (i > 0) {
 			// Add CQUAD elements
 			for (int z = 0; z < GRID_Vector.size(); z++) {
-				if (GRID_Map.find(GRID_Vector[z]) != GRID_Map.end()) {
-					std::vector<unsigned long> retrieved_vector = GRID_Map[GRID_Vector[z]]->getCQUAD_List();
+				GRID_it = GRID_Map.find(GRID_Vector[z]);
+				if (GRID_it != GRID_Map.end()) {
+					std::vector<unsigned long> retrieved_vector = GRID_it->second->getCQUAD_List();
 					//	Loop through retrieved vector and look for ID in node_QUADS vector
 					for (int k = 0; k < retrieved_vector.size(); k++) {
 						if (!std::binary_search(node_QUADS[side_no].begin(), node_QUADS[side_no].end(), retrieved_vector[k])) {
@@ -265,19 +262,21 @@ void CBUSH::parse_FH(std::map<unsigned long, GRID*> &GRID_Map, std::map<unsigned
 			}
 			// Check if any CQUAD elements were connected to the fastener node
 			if (QUAD_Vector.size() == 0) {
-				if (GRID_Map.find(GRID_Vector[0]) != GRID_Map.end()) {
-					std::vector<unsigned long> RBE_List = GRID_Map[GRID_Vector[0]]->getRBE2_List();
+				GRID_it = GRID_Map.find(GRID_Vector[0]);
+				if (GRID_it != GRID_Map.end()) {
+					std::vector<unsigned long> RBE_List = GRID_it->second->getRBE2_List();
 					bool check_RBE3 = false;
 					int num_dep_nodes = 0;
 					for (int k = 0; k < RBE_List.size(); k++) {
-						if (RBE2_Map.find(RBE_List[k]) != RBE2_Map.end()) {
+						std::map<unsigned long, RBE2*>::iterator RBE2_it = RBE2_Map.find(RBE_List[k]);
+						if (RBE2_it != RBE2_Map.end()) {
 							// Check number of connected nodes
-							num_dep_nodes = RBE2_Map[RBE_List[k]]->get_num_dependant_nodes();
+							num_dep_nodes = RBE2_it->second->get_num_dependant_nodes();
 							if (num_dep_nodes > 1) {
 								// RBE2 element is spidered onto a CQUAD element, get dependant nodes
 								GRID_Vector.clear();
 								for (int z = 3; z < (3 + num_dep_nodes); z++) {
-									GRID_Vector.push_back((*RBE2_Map[RBE_List[k]])[z]);
+									GRID_Vector.push_back((*RBE2_it->second)[z]);
 								}
 								check_RBE3 = true;
 								break;
@@ -288,13 +287,14 @@ void CBUSH::parse_FH(std::map<unsigned long, GRID*> &GRID_Map, std::map<unsigned
 						// No appropriate RBE2 connectivity, check for RBE3 connectivity
 						RBE_List = GRID_Map[GRID_Vector[0]]->getRBE3_List();
 						for (int k = 0; k < RBE_List.size(); k++) {
-							if (RBE3_Map.find(RBE_List[k]) != RBE3_Map.end()) {
-								num_dep_nodes = RBE3_Map[RBE_List[k]]->get_num_independant_nodes();
+							std::map<unsigned long, RBE3*>::iterator RBE3_it = RBE3_Map.find(RBE_List[k]);
+							if (RBE3_it != RBE3_Map.end()) {
+								num_dep_nodes = RBE3_it->second->get_num_independant_nodes();
 								if (num_dep_nodes > 1) {
 									// RBE3 element is spidered onto a CQUAD element, get dependant nodes
 									GRID_Vector.clear();
 									for (int z = 3; z < (3 + num_dep_nodes); z++) {
-										GRID_Vector.push_back((*RBE3_Map[RBE_List[k]])[z]);
+										GRID_Vector.push_back((*RBE3_it->second)[z]);
 									}
 									break;
 								}								
@@ -303,7 +303,7 @@ void CBUSH::parse_FH(std::map<unsigned long, GRID*> &GRID_Map, std::map<unsigned
 					}
 					// Get common CQUAD
 					if (GRID_Vector.size() > 0) {
-						std::map<unsigned long, GRID*>::iterator GRID_it = GRID_Map.find(GRID_Vector[0]);
+						GRID_it = GRID_Map.find(GRID_Vector[0]);
 						if (GRID_it != GRID_Map.end()) {
 							QUAD_Vector = GRID_it->second->getCQUAD_List();
 							// Iterate through additional grids
@@ -341,10 +341,11 @@ void CBUSH::parse_FH(std::map<unsigned long, GRID*> &GRID_Map, std::map<unsigned
 					std::vector<unsigned long> GRID_Vector_2;
 					//	Inspect CQUAD elements
 					for (int z = 0; z < node_QUADS[side_no].size(); z++) {
-						if (CQUAD_Map.find(node_QUADS[side_no][z]) != CQUAD_Map.end()) {
+						std::map<unsigned long, CQUAD*>::iterator CQUAD_it = CQUAD_Map.find(node_QUADS[side_no][z]);
+						if (CQUAD_it != CQUAD_Map.end()) {
 							// CQUAD found in model data, retrieve GRID IDs
 							for (int k = 2; k < 6; k++) {
-								unsigned long check_ID = (*CQUAD_Map[ node_QUADS[side_no][z] ])[k];
+								unsigned long check_ID = (*CQUAD_it->second)[k];
 								//	Search for GRID ID in previous list
 								if (!std::binary_search(GRID_Vector.begin(), GRID_Vector.end(), check_ID)) {
 									//	Not found so add to new list
@@ -383,26 +384,36 @@ std::vector<unsigned long> CBUSH::get_FH_NodeB()
 */
 
 /**
- *	@brief	Adds a force result entry from a NASTRAN punch file to the Force Result Map.
+ *	@brief	Gives the CBUSH the next element index of a result store, the force results of
+ *			the CBUSH are added to and read from the store. Attaching the store already
+ *			attached does nothing.
  *
- *	@param	lineEntries, a string vector stroing raw punch file line entries
- * 	@param 	SubcaseID, unsigned long integer of the subcase ID
+ *	@param	store, the result store of the model holding CBUSH force results
  *	@return	void
  */
 
-void CBUSH::addForceResult(std::vector<std::string> lineEntries, unsigned long SubcaseID)
+void CBUSH::attachResults(Result_Store* store)
 {
-	std::vector<std::string> LineData;
-	for (int j = 0; j < lineEntries.size(); j++) {
-		for (int i = 18; i < 72; i += 18) {
-			LineData.push_back(lineEntries[j].substr(i, 18));
-		}
+	if (pResults != store) {
+		pResults = store;
+		pResultIndex = store->add_element();
 	}
-	//	Enter Force results
-	Euclidean_Vector entry_vector;
-	for (int i = 0; i < 2; i++) {
-		entry_vector.set_vector(atof(check_exp(LineData[(3 * i) + 0]).c_str()), atof(check_exp(LineData[(3 * i) + 1]).c_str()), atof(check_exp(LineData[(3 * i) + 2]).c_str()));
-		Force_Res_Map[i].insert(std::pair<unsigned long, Euclidean_Vector > (SubcaseID, entry_vector));
+}
+
+/**
+ *	@brief	Adds a force result entry decoded from a NASTRAN punch file to the result store.
+ *			The first result entered for a subcase is kept, the result is dropped if no store
+ *			has been attached.
+ *
+ *	@param	values, a double array of the decoded results Fx, Fy, Fz, Mx, My, Mz
+ * 	@param 	SubcaseID, unsigned long integer of the subcase ID
+ *	@return	void
+ */
+
+void CBUSH::addForceResult(const double* values, unsigned long SubcaseID)
+{
+	if (pResults != NULL) {
+		pResults->add_result(pResultIndex, SubcaseID, values, false);
 	}
 }
 
@@ -417,12 +428,15 @@ void CBUSH::addForceResult(std::vector<std::string> lineEntries, unsigned long S
 std::vector<Euclidean_Vector> CBUSH::getForceResult(unsigned long SubcaseID, bool as_is, unsigned long COORD_ID, std::map<unsigned long, COORD*> &COORD_Map, std::map<unsigned long, GRID*> &GRID_Map)
 {
 	std::vector<Euclidean_Vector> return_vector;
-	std::map<unsigned long, Euclidean_Vector>::iterator res_it;
-	// Get force results from map
+	bool flag;
+	const double* values = NULL;
+	// Get force results from the result store
+	if (pResults != NULL) {
+		values = pResults->get_result(pResultIndex, SubcaseID, flag);
+	}
 	for (int i = 0; i < 2; i++) {
-		res_it = Force_Res_Map[i].find(SubcaseID);
-		if (res_it != Force_Res_Map[i].end()) {
-			return_vector.push_back(res_it->second);
+		if (values != NULL) {
+			return_vector.push_back(Euclidean_Vector(values[(3 * i) + 0], values[(3 * i) + 1], values[(3 * i) + 2]));
 		} else {
 			return_vector.push_back(Euclidean_Vector(0.0, 0.0, 0.0));
 		}
@@ -676,6 +690,7 @@ unsigned int CBUSH_axis[2])
 		Transformation mat_transformation;
 		if (!CBUSH_as_is) {
 			Euclidean_Vector mat_vector = side_1[side_no][0]->get_material_vector();
+			set_transform(COORD_Map, GRID_Map);
 			mat_vector = pTransformation[0].transform_vector(mat_vector);
 			switch (CBUSH_axis[0]) {
 				case 12: case 13:
@@ -773,8 +788,9 @@ unsigned int CBUSH_axis[2])
 std::vector<double> CBUSH::get_FH_Result(unsigned long SubcaseID, int side_no)
 {
 	std::vector<double> returnVector;
-	if (FH_Res_Map[side_no].find(SubcaseID) != FH_Res_Map[side_no].end()) {
-		returnVector = FH_Res_Map[side_no][SubcaseID];
+	std::map<unsigned long, std::vector<double> >::iterator FH_it = FH_Res_Map[side_no].find(SubcaseID);
+	if (FH_it != FH_Res_Map[side_no].end()) {
+		returnVector = FH_it->second;
 	} else {
 		for (int i = 0; i < 9; i++) {
 			returnVector.push_back(0.0);
@@ -809,8 +825,9 @@ std::vector<unsigned long> CBUSH::get_FH_CQUADs(int side_no)
 bool CBUSH::FH_Composite(int side_no, std::map<unsigned long, CQUAD*> &CQUAD_Map)
 {
 	for (int i = 0; i < node_QUADS[side_no].size(); i++) {
-		if (CQUAD_Map.find(node_QUADS[side_no][i]) != CQUAD_Map.end()) {
-			return CQUAD_Map[node_QUADS[side_no][i]]->is_Composite();
+		std::map<unsigned long, CQUAD*>::iterator CQUAD_it = CQUAD_Map.find(node_QUADS[side_no][i]);
+		if (CQUAD_it != CQUAD_Map.end()) {
+			return CQUAD_it->second->is_Composite();
 		}
 	}
 	return false;
@@ -844,40 +861,6 @@ unsigned long CBUSH::operator[] (unsigned int i)
 		return pLongData[0];
 	}
 }
-
-std::string CBUSH::check_exp(std::string& str)
-{
-    std::size_t first = str.find_first_not_of(' ');
-    if (first == std::string::npos)
-        return "";
-    std::size_t last = str.find_last_not_of(' ');
-	std::string tempStr = str.substr(first, (last-first+1));
-    // Check for NASTRAN exponent
-	std::size_t exp = tempStr.find_first_of('-', 1);
-	if (exp == std::string::npos) {
-		exp = tempStr.find_first_of('+', 1);
-	}
-	// Insert 'E' if exponent is found
-	if (exp != std::string::npos) {
-		std::size_t posEbig = tempStr.find_first_of('E');
-		std::size_t posEsma = tempStr.find_first_of('e');
-		if (posEbig == std::string::npos && posEsma == std::string::npos) {
-			tempStr.insert(exp, "E");
-		}
-	}
-	return tempStr;
-}
-
-bool CBUSH::checkReal(std::string &str)
-{
-	std::size_t found = str.find_first_of('.');
-	if (found == std::string::npos) {
-		return false;
-	} else {
-		return true;
-	}
-}
-
 bool sort_x(std::pair<Coordinate, CQUAD*> first_CQUAD, std::pair<Coordinate, CQUAD*> second_CQUAD) {
 	return (first_CQUAD.first[0] < second_CQUAD.first[0]);
 }
@@ -911,21 +894,24 @@ void CBUSH::order_FH(std::map<unsigned long, GRID*> &GRID_Map, std::map<unsigned
 		set_transform(COORD_Map, GRID_Map);
 	}
 	Coordinate retrieved_coord, fastener_node_coord(0.0, 0.0, 0.0);
+	std::map<unsigned long, GRID*>::iterator GRID_it;
 	for (int j = 0; j < node_QUADS[side_no].size(); j++) {
-		if (CQUAD_Map.find(node_QUADS[side_no][j]) != CQUAD_Map.end()) {
+		std::map<unsigned long, CQUAD*>::iterator CQUAD_it = CQUAD_Map.find(node_QUADS[side_no][j]);
+		if (CQUAD_it != CQUAD_Map.end()) {
 			switch (pOrienType) {
 				case 1: case 2:
-					retrieved_coord = CQUAD_Map[node_QUADS[side_no][j]]->getCentroid(0, COORD_Map);
-					if (GRID_Map.find(fastenerNodes[side_no]) != GRID_Map.end()) {
-						fastener_node_coord = GRID_Map[fastenerNodes[side_no]]->get_coordinate(0, COORD_Map);
+					retrieved_coord = CQUAD_it->second->getCentroid(0, COORD_Map);
+					GRID_it = GRID_Map.find(fastenerNodes[side_no]);
+					if (GRID_it != GRID_Map.end()) {
+						fastener_node_coord = GRID_it->second->get_coordinate(0, COORD_Map);
 					}
 					retrieved_coord -= fastener_node_coord;
 					retrieved_coord = pTransformation[0].transform_coordinate(retrieved_coord);
-					all_elements.push_back(std::pair<Coordinate, CQUAD*> (retrieved_coord, CQUAD_Map[node_QUADS[side_no][j]]));
+					all_elements.push_back(std::pair<Coordinate, CQUAD*> (retrieved_coord, CQUAD_it->second));
 					break;
 				default:
-					retrieved_coord = CQUAD_Map[node_QUADS[side_no][j]]->getCentroid(pLongData[5], COORD_Map);
-					all_elements.push_back(std::pair<Coordinate, CQUAD*> (retrieved_coord, CQUAD_Map[node_QUADS[side_no][j]]));
+					retrieved_coord = CQUAD_it->second->getCentroid(pLongData[5], COORD_Map);
+					all_elements.push_back(std::pair<Coordinate, CQUAD*> (retrieved_coord, CQUAD_it->second));
 			}
 
 		}
@@ -998,3 +984,26 @@ void CBUSH::set_transform(std::map<unsigned long, COORD*> &COORD_Map, std::map<u
 	}
 }
 
+void CBUSH::writeSnapshot(Binary_Writer &writer)
+{
+	for (int i = 0; i < 7; i++) { writer.write_ulong(pLongData[i]); }
+	writer.write_double(pS);
+	writer.write_ulong(pOrienType);
+	writer.write_ulong(fastenerNodes[0]);
+	writer.write_ulong(fastenerNodes[1]);
+	pCoordinate[0].writeSnapshot(writer);
+	pCoordinate[1].writeSnapshot(writer);
+}
+
+void CBUSH::readSnapshot(Binary_Reader &reader)
+{
+	for (int i = 0; i < 7; i++) { pLongData[i] = reader.read_ulong(); }
+	pS = reader.read_double();
+	pOrienType = reader.read_ulong();
+	fastenerNodes[0] = reader.read_ulong();
+	fastenerNodes[1] = reader.read_ulong();
+	pCoordinate[0].readSnapshot(reader);
+	pCoordinate[1].readSnapshot(reader);
+	pTransFlag = false;
+	pNodeSort = false;
+}
@@ -13,6 +13,10 @@
 #include "NASTRAN_General/COORD.h"
 #include "Math/Euclidean_Vector.h"
 #include "Math/Coordinate.h"
+#include "NASTRAN_General/BDF_Line.h"
+#include "NASTRAN_General/BDF_Tokenizer.h"
+#include "IO/Binary_Writer.h"
+#include "IO/Binary_Reader.h"
 
 #include <iostream>
 #include <vector>
@@ -30,11 +34,11 @@ COORD::COORD()
 /**
  *	@brief	Constructor also parsing Bulk Data File data, runs parseBDFData
  *
- *	@param	BDF_Data, a string vector containing Bulk Data File input lines
+ *	@param	BDF_Data, a BDF_Line vector of the Bulk Data File input lines
  * 	@param 	LongFormatFlag, a boolean flagging format type
  */
 
-COORD::COORD(std::vector<std::string> BDF_Data, bool LongFormatFlag)
+COORD::COORD(std::vector<BDF_Line> &BDF_Data, bool LongFormatFlag)
 {
 	parseBDFData(BDF_Data, LongFormatFlag);
 }
@@ -49,35 +53,20 @@ COORD::~COORD()
 			File has a short and a long format recognised by NASTRAN, the flag 
 			modifies how the input data is parsed for these occurences.
  *
- *	@param	BDF_Data, a string vector containing Bulk Data File input lines
+ *	@param	BDF_Data, a BDF_Line vector of the Bulk Data File input lines
  * 	@param 	LongFormatFlag, a boolean flagging format type
  *	@return	void
  */
 
-void COORD::parseBDFData(std::vector<std::string> BDF_Data, bool LongFormatFlag)
+void COORD::parseBDFData(std::vector<BDF_Line> &BDF_Data, bool LongFormatFlag)
 {
-	// Initiate a string vector to store split data
-	std::vector<std::string> LineData;
-	if (!LongFormatFlag) {
-		// Short Format, data fields every 8 characters (80 chars max)
-		for (int i = 0; i < BDF_Data.size(); i++) {
-			for (int j = 8; j < 72; j += 8) {
-				LineData.push_back(BDF_Data[i].substr(j, 8));
-			}
-		}
-	} else {
-		// Long Format, data fields every 16 characters after inital 8 characters (80 chars max)
-		for (int i = 0; i < BDF_Data.size(); i++) {
-			for (int j = 8; j < 72; j += 16) {
-				LineData.push_back(BDF_Data[i].substr(j, 16));
-			}
-		}
-	}
+	// Split the card into fixed width fields, no data is copied
+	BDF_Tokenizer fields(BDF_Data, LongFormatFlag);
 	// Parse COORD ID and Ref Coordinate ID
-	for (int i = 0; i < 2; i++) { pLongData[i] = atol(LineData[i].c_str()); }
+	for (int i = 0; i < 2; i++) { pLongData[i] = fields.field(i).to_long(); }
 	// Parse Origin, Point B and Point C
 	double tempArray[9];
-	for (int i = 0; i < 9; i++) { tempArray[i] = atof(check_exp(LineData[i + 2]).c_str()); }
+	for (int i = 0; i < 9; i++) { tempArray[i] = fields.field(i + 2).to_double(); }
 	pOrigin.set_coordinates(tempArray[0], tempArray[1], tempArray[2]);
 	Coordinate point_B(tempArray[3], tempArray[4], tempArray[5]);
 	Coordinate point_C(tempArray[6], tempArray[7], tempArray[8]);
@@ -218,26 +207,20 @@ unsigned long COORD::operator[](int i)
 	}
 }
 
+void COORD::writeSnapshot(Binary_Writer &writer)
+{
+	writer.write_ulong(pLongData[0]);
+	writer.write_ulong(pLongData[1]);
+	pOrigin.writeSnapshot(writer);
+	pTransMatrices[0].writeSnapshot(writer);
+	pTransMatrices[1].writeSnapshot(writer);
+}
 
-std::string COORD::check_exp(std::string& str)
+void COORD::readSnapshot(Binary_Reader &reader)
 {
-    std::size_t first = str.find_first_not_of(' ');
-    if (first == std::string::npos)
-        return "";
-    std::size_t last = str.find_last_not_of(' ');
-	std::string tempStr = str.substr(first, (last-first+1));
-    // Check for NASTRAN exponent
-	std::size_t exp = tempStr.find_first_of('-', 1);
-	if (exp == std::string::npos) {
-		exp = tempStr.find_first_of('+', 1);
-	}
-	// Insert 'E' if exponent is found
-	if (exp != std::string::npos) {
-		std::size_t posEbig = tempStr.find_first_of('E');
-		std::size_t posEsma = tempStr.find_first_of('e');
-		if (posEbig == std::string::npos && posEsma == std::string::npos) {
-			tempStr.insert(exp, "E");
-		}
-	}
-	return tempStr;
+	pLongData[0] = reader.read_ulong();
+	pLongData[1] = reader.read_ulong();
+	pOrigin.readSnapshot(reader);
+	pTransMatrices[0].readSnapshot(reader);
+	pTransMatrices[1].readSnapshot(reader);
 }
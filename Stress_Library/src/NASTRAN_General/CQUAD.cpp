@@ -18,6 +18,12 @@
 #include "Math/Euclidean_Vector.h"
 #include "Math/Coordinate.h"
 #include "Stress/CAUCHY_STRESS.h"
+#include "NASTRAN_General/BDF_Line.h"
+#include "NASTRAN_General/BDF_Tokenizer.h"
+#include "NASTRAN_General/BDF_Field.h"
+#include "NASTRAN_General/Result_Store.h"
+#include "IO/Binary_Writer.h"
+#include "IO/Binary_Reader.h"
 
 #include <iostream>
 #include <vector>
@@ -29,26 +35,47 @@
 
 CQUAD::CQUAD()
 {
-    for (int i = 1; i < 4; i++) { pBoolData[i] = false; }
+    for (int i = 0; i < 7; i++) { pLongData[i] = 0; }
+    for (int i = 0; i < 4; i++) { pDoubleData[i] = 0.0; }
+    for (int i = 0; i < 4; i++) { pBoolData[i] = false; }
     pCentroid.set_coordinates(0.0, 0.0, 0.0);
+    pResults = NULL;
+    pResultIndex = 0;
+    pPlyResults = NULL;
+    pPlyIndex = 0;
 }
 
 /**
  *	@brief	Constructor also parsing Bulk Data File data, runs parse_BDF_data
  *
- *	@param	BDF_Data, a string vector containing Bulk Data File input lines
+ *	@param	BDF_Data, a BDF_Line vector of the Bulk Data File input lines
  * 	@param 	LongFormatFlag, a boolean flagging format type
  */
 
-CQUAD::CQUAD(std::vector<std::string> BDF_Data, bool LongFormatFlag)
+CQUAD::CQUAD(std::vector<BDF_Line> &BDF_Data, bool LongFormatFlag)
 {
-	CQUAD();
+	for (int i = 0; i < 7; i++) { pLongData[i] = 0; }
+	for (int i = 0; i < 4; i++) { pDoubleData[i] = 0.0; }
+	for (int i = 0; i < 4; i++) { pBoolData[i] = false; }
+	pCentroid.set_coordinates(0.0, 0.0, 0.0);
+	pResults = NULL;
+	pResultIndex = 0;
+	pPlyResults = NULL;
+	pPlyIndex = 0;
 	parseBDFData(BDF_Data, LongFormatFlag);
 }
 
 CQUAD::CQUAD(unsigned long ElementID)
 {
+	for (int i = 1; i < 7; i++) { pLongData[i] = 0; }
+	for (int i = 0; i < 4; i++) { pDoubleData[i] = 0.0; }
+	for (int i = 0; i < 4; i++) { pBoolData[i] = false; }
+	pCentroid.set_coordinates(0.0, 0.0, 0.0);
 	pLongData[0] = ElementID;
+	pResults = NULL;
+	pResultIndex = 0;
+	pPlyResults = NULL;
+	pPlyIndex = 0;
 }
 
 CQUAD::~CQUAD()
@@ -61,50 +88,38 @@ CQUAD::~CQUAD()
 			File has a short and a long format recognised by NASTRAN, the flag 
 			modifies how the input data is parsed for these occurences.
  *
- *	@param	BDF_Data, a string vector containing Bulk Data File input lines
+ *	@param	BDF_Data, a BDF_Line vector of the Bulk Data File input lines
  * 	@param 	LongFormatFlag, a boolean flagging format type
  *	@return	void
  */
 
-void CQUAD::parseBDFData(std::vector<std::string> BDF_Data, bool LongFormatFlag)
+void CQUAD::parseBDFData(std::vector<BDF_Line> &BDF_Data, bool LongFormatFlag)
 {
-	std::vector<std::string> LineData;  ///< String vector to store seperated line entries for parsing
-	if (!LongFormatFlag) {
-		// Short Format, data fields every 8 characters (80 chars max)
-		for (int i = 8; i < 72; i += 8) {
-			LineData.push_back(BDF_Data[0].substr(i, 8));
-		}
-
-	} else {
-		// Long Format, data fields every 16 characters after inital 8 characters (80 chars max)
-        for (int i = 0; i < BDF_Data.size(); i++) {
-            for (int j = 8; j < 72; j += 16) {
-                LineData.push_back(BDF_Data[i].substr(j, 16));
-            }
-        }
-	}
-	// Parse Longs
-	for (int i = 0; i < 6; i++) { pLongData[i] = atol(LineData[i].c_str()); }
+	// Split the card into fixed width fields, no data is copied
+	BDF_Tokenizer fields(BDF_Data, LongFormatFlag);
+	// Parse Longs, the MCID is only set when THETA/MCID is an integer
+	for (int i = 0; i < 6; i++) { pLongData[i] = fields.field(i).to_long(); }
+	pLongData[6] = 0;
 	// Parse the theta/MCID entry
-    std::string str = check_exp(LineData[6]);
-	if (str.compare("") == 0) {
+	BDF_Field field = fields.field(6);
+	if (field.is_blank()) {
 		// Default value
 		pBoolData[0] = false;
 		pDoubleData[1] = 0.0;
 	} else {
 		// Not default
-		if (checkReal(str)) {
+		if (field.is_real()) {
 			// Not an integer
 			pBoolData[0] = false;
-			pDoubleData[1] = atof(str.c_str());
+			pDoubleData[1] = field.to_double();
 		} else {
 			// Is supposedly an integer/long
 			pBoolData[0] = true;
-			pLongData[6] = atol(str.c_str());
+			pLongData[6] = field.to_long();
 		}
 	}
 	// Parse zOffset
-	pDoubleData[0] = atof(check_exp(LineData[7]).c_str());
+	pDoubleData[0] = fields.field(7).to_double();
 }
 
 /**
@@ -162,6 +177,7 @@ bool CQUAD::checkMCIDValid()
 
 void CQUAD::parseComposite(std::map<unsigned long, PCOMP*> &PCOMP_Map, std::map<unsigned long, PSHELL*> &PSHELL_Map, std::map<unsigned long, MAT*> &MAT_Map)
 {
+	pBoolData[1] = false;
 	if (PCOMP_Map.find(pLongData[1]) != PCOMP_Map.end()) {
 		// Found PCOMP
 		pBoolData[1] = true;
@@ -193,18 +209,38 @@ bool CQUAD::is_Composite()
 
 void CQUAD::nodeConnect(std::map<unsigned long, GRID*> &GRID_Map, std::map<unsigned long, COORD*> &COORD_Map)
 {
-	Coordinate pNodes[4];
+	GRID* grids[4];
 	std::map<unsigned long, GRID*>::iterator Grid_it;
 	for (int i = 2; i < 6; i++) {
 		//	Find CQUAD corner GRIDs in the GRID map for the model
 		Grid_it = GRID_Map.find(pLongData[i]);
-		if (Grid_it != GRID_Map.end()) {
+		grids[i - 2] = Grid_it != GRID_Map.end() ? Grid_it->second : NULL;
+	}
+	nodeConnect(grids, COORD_Map);
+}
+
+/**
+ *	@brief	Updates the GRID entry connectivity array of the four CQUAD nodes, found by the
+ *			caller, and calculates the CQUAD element centroid as for the GRID map version.
+ *
+ *	@param	grids, the GRIDs of the four CQUAD nodes in order, NULL for a node not in the model
+ * 	@param 	COORD_Map, a map of all the COORD systems present in the model
+ *	@return	void
+ */
+
+void CQUAD::nodeConnect(GRID* (&grids)[4], std::map<unsigned long, COORD*> &COORD_Map)
+{
+	Coordinate pNodes[4];
+	//	Reset centroid, the CQUAD is reconnected when its GRIDs change
+	pCentroid.set_coordinates(0.0, 0.0, 0.0);
+	for (int i = 0; i < 4; i++) {
+		if (grids[i] != NULL) {
 			//	Add CQUAD ID to GRID connectivity
-			Grid_it->second->addCQUAD_Connect(pLongData[0]);
+			grids[i]->addCQUAD_Connect(pLongData[0]);
 			//	Get coordinate point
-			pNodes[i - 2] = Grid_it->second->get_coordinate(0, COORD_Map);
+			pNodes[i] = grids[i]->get_coordinate(0, COORD_Map);
 			//	Add coordinate point to centroid
-			pCentroid += pNodes[i - 2];
+			pCentroid += pNodes[i];
 		}
 	}
 	//	Set CQUAD centroid
@@ -212,7 +248,7 @@ void CQUAD::nodeConnect(std::map<unsigned long, GRID*> &GRID_Map, std::map<unsig
 	//	Calculate side lengths
 	Euclidean_Vector side_vectors[4];
 	for (int i = 0; i < 4; i++) {
-		if (i == 4) {
+		if (i == 3) {
 			side_vectors[i].set_vector(pNodes[0][0] - pNodes[i][0], pNodes[0][1] - pNodes[i][1], pNodes[0][2] - pNodes[i][2]);
 		} else {
 			side_vectors[i].set_vector(pNodes[i + 1][0] - pNodes[i][0], pNodes[i + 1][1] - pNodes[i][1], pNodes[i + 1][2] - pNodes[i][2]);
@@ -223,6 +259,23 @@ void CQUAD::nodeConnect(std::map<unsigned long, GRID*> &GRID_Map, std::map<unsig
 	pDoubleData[3] = (side_vectors[0][3] + side_vectors[2][3]) / 2; 
 }
 
+bool CQUAD::sameBDFData(CQUAD &other)
+{
+	for (int i = 0; i < 6; i++) {
+		if (pLongData[i] != other.pLongData[i]) {
+			return false;
+		}
+	}
+	if (pBoolData[0] != other.pBoolData[0] || pDoubleData[0] != other.pDoubleData[0]) {
+		return false;
+	}
+	//	Only one of MCID and theta is set by the card
+	if (pBoolData[0]) {
+		return pLongData[6] == other.pLongData[6];
+	}
+	return pDoubleData[1] == other.pDoubleData[1];
+}
+
 Euclidean_Vector CQUAD::get_material_vector()
 {
 	Euclidean_Vector return_vector(1.0, 0.0, 0.0);
@@ -233,38 +286,42 @@ Euclidean_Vector CQUAD::get_material_vector()
 }
 
 /**
- *	@brief	Adds a force result entry from a NASTRAN punch file to the Force Result Map.
+ *	@brief	Gives the CQUAD the next element index of a result store, the force results of
+ *			the CQUAD are added to and read from the store. Attaching the store already
+ *			attached does nothing.
  *
- *	@param	lineEntries, a string vector stroing raw punch file line entries
+ *	@param	store, the result store of the model holding CQUAD force results
+ *	@return	void
+ */
+
+void CQUAD::attachResults(Result_Store* store)
+{
+	if (pResults != store) {
+		pResults = store;
+		pResultIndex = store->add_element();
+	}
+}
+
+/**
+ *	@brief	Adds a force result entry decoded from a NASTRAN punch file to the result store.
+ *			The first result entered for a subcase is kept, the result is dropped if no store
+ *			has been attached.
+ *
+ *	@param	values, a double array of the decoded results Nx, Ny, Nxy, Mx, My, Mxy, Vx, Vy
  * 	@param 	SubcaseID, unsigned long integer of the subcase ID
  *	@param	in_mat, a bool flagging whether results are in material CID or not
  *	@return	void
  */
 
-void CQUAD::addForceResult(std::vector<std::string> lineEntries, unsigned long SubcaseID, bool in_mat)
+void CQUAD::addForceResult(const double* values, unsigned long SubcaseID, bool in_mat)
 {
-	std::vector<std::string> LineData;
-	for (int j = 0; j < lineEntries.size(); j++) {
-		for (int i = 18; i < 72; i += 18) {
-			LineData.push_back(lineEntries[j].substr(i, 18));
-		}
+	if (pResults != NULL) {
+		pResults->add_result(pResultIndex, SubcaseID, values, in_mat);
 	}
-	// Enter in-plane fluxes as CAUCHY_STRESS
-	CAUCHY_STRESS entryCauchy(atof(check_exp(LineData[0]).c_str()), atof(check_exp(LineData[1]).c_str()), atof(check_exp(LineData[2]).c_str()));
-	N_Map.insert(std::pair<unsigned long, std::pair<CAUCHY_STRESS, bool> > (SubcaseID, std::pair<CAUCHY_STRESS, bool> (entryCauchy, in_mat)));
-	// Enter moments as CAUCHY_STRESS
-	entryCauchy.set_values(atof(check_exp(LineData[3]).c_str()), atof(check_exp(LineData[4]).c_str()), atof(check_exp(LineData[5]).c_str()));
-	M_Map.insert(std::pair<unsigned long, std::pair<CAUCHY_STRESS, bool> > (SubcaseID, std::pair<CAUCHY_STRESS, bool> (entryCauchy, in_mat)));
-	// Enter out of plane fluxes
-	std::vector<double> entryVector;
-	for (int i = 6; i < 8; i++) {
-		entryVector.push_back(atof(check_exp(LineData[i]).c_str()));
-	}	
-	V_Map.insert(std::pair<unsigned long, std::pair<std::vector<double>, bool> > (SubcaseID, std::pair<std::vector<double>, bool> (entryVector, in_mat)));
 }
 
 /**
- *	@brief	Gets a force result entry from the force result maps. Results can be requested in 
+ *	@brief	Gets a force result entry from the result store. Results can be requested in 
  *			material axis system, or in the direction of a specific vector.
  *
  * 	@param 	SubcaseID, unsigned long integer of the subcase ID
@@ -282,8 +339,9 @@ std::vector<double> CQUAD::getForceResult(unsigned long SubcaseID, bool in_mat,
 		//	Get CQUAD corner node coordinates
 		Coordinate QUAD_Coords[4];
 		for (int i = 2; i < 6; i++) {
-			if (GRID_Map.find(pLongData[i]) != GRID_Map.end()) {
-				QUAD_Coords[i - 2] = GRID_Map[pLongData[i]]->get_coordinate(0, COORD_Map);
+			std::map<unsigned long, GRID*>::iterator GRID_it = GRID_Map.find(pLongData[i]);
+			if (GRID_it != GRID_Map.end()) {
+				QUAD_Coords[i - 2] = GRID_it->second->get_coordinate(0, COORD_Map);
 			} else {
 				QUAD_Coords[i - 2].set_coordinates(0.0, 0.0, 0.0);
 			}
@@ -309,8 +367,9 @@ std::vector<double> CQUAD::getForceResult(unsigned long SubcaseID, bool in_mat,
 		//	Calculate material angle
 		if (pBoolData[0]) {
 			//	Get material coord system
-			if (COORD_Map.find(pLongData[6]) != COORD_Map.end()) {
-				Euclidean_Vector mat_vector = COORD_Map[pLongData[6]]->get_axis_vector(0, false, 0, COORD_Map);
+			std::map<unsigned long, COORD*>::iterator COORD_it = COORD_Map.find(pLongData[6]);
+			if (COORD_it != COORD_Map.end()) {
+				Euclidean_Vector mat_vector = COORD_it->second->get_axis_vector(0, false, 0, COORD_Map);
 				mat_angle = x_elm.get_angle(mat_vector);
 				double check_angle = y_elm.get_angle(mat_vector);
 				if (check_angle > 1.570796) {
@@ -325,74 +384,46 @@ std::vector<double> CQUAD::getForceResult(unsigned long SubcaseID, bool in_mat,
 		//	Internal angles and vectors have been calculated, set flag to true
 		pBoolData[2] = true;
 	}
-	//	Retrieve requested force result
+	//	Retrieve requested force result, in-plane forces then in-plane moments
 	std::vector<double> returnVector;
-	std::map<unsigned long, std::pair<CAUCHY_STRESS, bool> >::iterator map_it;
-	if (in_mat)	{
-		//	Results requested in material coordinate system
-		map_it = N_Map.find(SubcaseID);
-		//	In-Plane Forces
-		if (map_it != N_Map.end()) {
-			if (map_it->second.second) {
-				//	Results already in material coordinate system
-				for (int i = 0; i < 3; i++) {
-					returnVector.push_back(map_it->second.first[i]);
-				}
-			} else {
-				//	Results not in material coordinate system, apply rotation
-				map_it->second.first.rotate(mat_angle);
-				for (int i = 4; i < 7; i++) {
-					returnVector.push_back(map_it->second.first[i]);
-				}
-			}
-		}
-		//	In-Plane Moments -> As above for in-plane forces
-		map_it = M_Map.find(SubcaseID);
-		if (map_it != M_Map.end()) {
-			if (map_it->second.second) {
-				for (int i = 0; i < 3; i++) {
-					returnVector.push_back(map_it->second.first[i]);
-				}
-			} else {
-				map_it->second.first.rotate(mat_angle);
-				for (int i = 4; i < 7; i++) {
-					returnVector.push_back(map_it->second.first[i]);
-				}
-			}
-		}		
-	} else {
-		//	Results not requested in material coordinate system
-		if (default_vector == NULL) {
-			//	Default vector for results not given, return results in CQUAD element coordinate system
-			map_it = N_Map.find(SubcaseID);
-			//	In-Plane Forces
-			if (map_it != N_Map.end()) {
-				if (!map_it->second.second) {
-					//	Results already in CQUAD analysis coordinate system
+	bool stored_in_mat = false;
+	const double* values = NULL;
+	if (pResults != NULL) {
+		values = pResults->get_result(pResultIndex, SubcaseID, stored_in_mat);
+	}
+	if (values != NULL) {
+		CAUCHY_STRESS result[2] = {CAUCHY_STRESS(values[0], values[1], values[2]), CAUCHY_STRESS(values[3], values[4], values[5])};
+		if (in_mat) {
+			//	Results requested in material coordinate system
+			for (int j = 0; j < 2; j++) {
+				if (stored_in_mat) {
+					//	Results already in material coordinate system
 					for (int i = 0; i < 3; i++) {
-						returnVector.push_back(map_it->second.first[i]);
+						returnVector.push_back(result[j][i]);
 					}
 				} else {
-					//	Results not in CQUAD analysis coordinate system, apply rotation
-					map_it->second.first.rotate(0.0 - mat_angle);
+					//	Results not in material coordinate system, apply rotation
+					result[j].rotate(mat_angle);
 					for (int i = 4; i < 7; i++) {
-						returnVector.push_back(map_it->second.first[i]);
+						returnVector.push_back(result[j][i]);
 					}
-				}				
+				}
 			}
-			map_it = M_Map.find(SubcaseID);
-			//	In-Plane Moments -> As above for in-plane forces
-			if (map_it != M_Map.end()) {
-				if (!map_it->second.second) {
+		} else if (default_vector == NULL) {
+			//	Default vector for results not given, return results in CQUAD element coordinate system
+			for (int j = 0; j < 2; j++) {
+				if (!stored_in_mat) {
+					//	Results already in CQUAD analysis coordinate system
 					for (int i = 0; i < 3; i++) {
-						returnVector.push_back(map_it->second.first[i]);
+						returnVector.push_back(result[j][i]);
 					}
 				} else {
-					map_it->second.first.rotate(0.0 - mat_angle);
+					//	Results not in CQUAD analysis coordinate system, apply rotation
+					result[j].rotate(0.0 - mat_angle);
 					for (int i = 4; i < 7; i++) {
-						returnVector.push_back(map_it->second.first[i]);
+						returnVector.push_back(result[j][i]);
 					}
-				}				
+				}
 			}
 		} else {
 			//	Vector supplied for results, calculate angle for translation
@@ -402,33 +433,19 @@ std::vector<double> CQUAD::getForceResult(unsigned long SubcaseID, bool in_mat,
 			if (x_elm.get_angle(proj_vector) > 1.570796) {
 				rot_angle *= -1;
 			}
-			//	In-Plane Forces
-			map_it = N_Map.find(SubcaseID);
-			if (map_it != N_Map.end()) {
-				if (map_it->second.second) {
+			for (int j = 0; j < 2; j++) {
+				if (stored_in_mat) {
 					//	Results are in material axis, apply rotation
-					map_it->second.first.rotate(rot_angle - mat_angle);
+					result[j].rotate(rot_angle - mat_angle);
 				} else {
 					//	Results are in CQUAD analysis coordinate system, apply rotation
-					map_it->second.first.rotate(rot_angle);
+					result[j].rotate(rot_angle);
 				}
 				//	Push results back to return_Vector
 				for (int i = 4; i < 7; i++) {
-					returnVector.push_back(map_it->second.first[i]);
+					returnVector.push_back(result[j][i]);
 				}
 			}
-			//	In-Plane Moments -> As above for in-plane forces
-			map_it = M_Map.find(SubcaseID);
-			if (map_it != M_Map.end()) {
-				if (map_it->second.second) {
-					map_it->second.first.rotate(rot_angle - mat_angle);
-				} else {
-					map_it->second.first.rotate(rot_angle);
-				}
-				for (int i = 4; i < 7; i++) {
-					returnVector.push_back(map_it->second.first[i]);
-				}
-			}			
 		}
 	}
 	//	Check return_Vector and then return
@@ -439,57 +456,72 @@ std::vector<double> CQUAD::getForceResult(unsigned long SubcaseID, bool in_mat,
 	return returnVector;
 }
 
+/**
+ *	@brief	Gives the CQUAD the next element index of a ply result store, the ply stress
+ *			results of the CQUAD are added to and read from the store. Attaching the store
+ *			already attached does nothing.
+ *
+ *	@param	store, the ply result store of the model holding CQUAD ply stresses
+ *	@return	void
+ */
 
-
-/*
-void CQUAD::addPlyStressResult(std::vector<std::string> lineEntries, unsigned long SubcaseID, bool in_mat)
+void CQUAD::attachPlyResults(Ply_Store* store)
 {
-	std::vector<std::string> LineData;
-	for (int j = 0; j < lineEntries.size(); j++) {
-		for (int i = 18; i < 72; i += 18) {
-			LineData.push_back(lineEntries[j].substr(i, 18));
-		}
-	}	
-	std::vector<double> entryVector;
-	unsigned int ply_number;
-	try {
-		ply_number = atol(trim(LineData[0]).c_str());
-	} catch (int e) {
-		ply_number = 0;
+	if (pPlyResults != store) {
+		pPlyResults = store;
+		pPlyIndex = store->add_element();
 	}
-	for (int i = 1; i < 10; i++) {
-		try {
-			entryVector.push_back(atof(trim(LineData[i]).c_str()));
-		} catch (int e) {
-			entryVector.push_back(0.0);
-		}
+}
+
+/**
+ *	@brief	Adds a ply stress result entry decoded from a NASTRAN punch file to the ply result
+ *			store. The first result entered for a ply and subcase is kept, the result is
+ *			dropped if no store has been attached.
+ *
+ *	@param	values, a double array of the decoded results S1, S2, S12, S1Z, S2Z, Angle, Major,
+ *			Minor, Max Shear in ply axis
+ *	@param	Ply, the ply ID
+ * 	@param 	SubcaseID, unsigned long integer of the subcase ID
+ *	@return	void
+ */
+
+void CQUAD::addPlyStressResult(const double* values, unsigned int Ply, unsigned long SubcaseID)
+{
+	if (pPlyResults != NULL) {
+		pPlyResults->add_result(pPlyIndex, SubcaseID, Ply, values);
 	}
-	std::pair<std::vector<double>, bool> ply_data = std::pair<std::vector<double>, bool> (entryVector, in_mat);
-	std::map<unsigned long, std::map<unsigned int, std::pair<std::vector<double>, bool> > >::iterator Ply_Stress_Res_it = Ply_Stress_Res_Map.find(SubcaseID);
-	if (Ply_Stress_Res_it == Ply_Stress_Res_Map.end()) {
-		std::map<unsigned int, std::pair<std::vector<double>, bool> > entry_map;
-		entry_map.insert(std::pair<unsigned int, std::pair<std::vector<double>, bool> > (ply_number, ply_data));
-		Ply_Stress_Res_Map.insert(std::pair<unsigned long, std::map<unsigned int, std::pair<std::vector<double>, bool> > > (SubcaseID, entry_map));
-	} else {
-		Ply_Stress_Res_it->second.insert(std::pair<unsigned int, std::pair<std::vector<double>, bool> > (ply_number, ply_data));
+}
+
+unsigned int CQUAD::getPlyCount(unsigned long SubcaseID)
+{
+	if (pPlyResults == NULL) {
+		return 0;
 	}
-	pBoolData[2] = true;
+	return pPlyResults->ply_count(pPlyIndex, SubcaseID);
 }
 
-std::map<unsigned int, std::pair<std::vector<double>, bool> > CQUAD::getPlyStresses(unsigned long SubcaseID)
+/**
+ *	@brief	Gets a ply stress result entry from the ply result store, plies are in the order
+ *			of the punch file.
+ *
+ * 	@param 	SubcaseID, unsigned long integer of the subcase ID
+ *	@param	Position, the position of the ply, 0 -> getPlyCount - 1
+ *	@param	Ply, set to the ply ID
+ *	@param	values, a double array set to S1, S2, S12, S1Z, S2Z, Angle, Major, Minor, Max Shear
+ *	@return	bool, false if there is no ply result at Position
+ */
+
+bool CQUAD::getPlyStressResult(unsigned long SubcaseID, unsigned int Position, unsigned int &Ply, double* values)
 {
-	if (Ply_Stress_Res_Map.find(SubcaseID) != Ply_Stress_Res_Map.end()) {
-		// Found
-		return Ply_Stress_Res_Map[SubcaseID];
-	} else {
-		// Not found create dummy and return
-		std::vector<double> dummyVector;
-		std::map<unsigned int, std::pair<std::vector<double>, bool> > dummy_Map;
-		dummy_Map.insert(std::pair<unsigned int, std::pair<std::vector<double>, bool> > (SubcaseID, std::pair <std::vector<double>, bool> (dummyVector, false)));
-		return dummy_Map;
+	if (pPlyResults == NULL) {
+		return false;
 	}
+	return pPlyResults->get_result(pPlyIndex, SubcaseID, Position, Ply, values);
 }
 
+
+
+/*
 void CQUAD::addStressResult(std::vector<std::string> lineEntries, unsigned long SubcaseID, bool in_mat)
 {
 	std::vector<std::string> LineData;
@@ -579,43 +611,6 @@ double CQUAD::operator() (int i)
 			return pDoubleData[0];
 	}
 }
-
-std::string CQUAD::check_exp(std::string& str)
-{
-    std::size_t first = str.find_first_not_of(' ');
-    if (first == std::string::npos)
-        return "";
-    std::size_t last = str.find_last_not_of(' ');
-	std::string tempStr = str.substr(first, (last-first+1));
-    // Check for NASTRAN exponent
-	std::size_t exp = tempStr.find_first_of('-', 1);
-	if (exp == std::string::npos) {
-		exp = tempStr.find_first_of('+', 1);
-	}
-	// Insert 'E' if exponent is found
-	if (exp != std::string::npos) {
-		std::size_t posEbig = tempStr.find_first_of('E');
-		std::size_t posEsma = tempStr.find_first_of('e');
-		if (posEbig == std::string::npos && posEsma == std::string::npos) {
-			tempStr.insert(exp, "E");
-		}
-	}
-	return tempStr;
-}
-
-bool CQUAD::checkReal(std::string &str)
-{
-	std::size_t found = str.find_first_of('.');
-	if (found == std::string::npos) {
-		return false;
-	} else {
-		return true;
-	}
-}
-
-
-
-
 /*
 std::vector<double> CQUAD::vector_Cross(std::vector<double> vector_A, std::vector<double> vector_B)
 {
@@ -692,3 +687,24 @@ double CQUAD::angle_Vectors(std::vector<double> vector_A, std::vector<double> ve
 	
 }
 */
+
+void CQUAD::writeSnapshot(Binary_Writer &writer)
+{
+	for (int i = 0; i < 7; i++) { writer.write_ulong(pLongData[i]); }
+	for (int i = 0; i < 4; i++) { writer.write_double(pDoubleData[i]); }
+	//	Flags 2 and 3 mark values calculated on demand, they are not stored
+	writer.write_bool(pBoolData[0]);
+	writer.write_bool(pBoolData[1]);
+	pCentroid.writeSnapshot(writer);
+}
+
+void CQUAD::readSnapshot(Binary_Reader &reader)
+{
+	for (int i = 0; i < 7; i++) { pLongData[i] = reader.read_ulong(); }
+	for (int i = 0; i < 4; i++) { pDoubleData[i] = reader.read_double(); }
+	pBoolData[0] = reader.read_bool();
+	pBoolData[1] = reader.read_bool();
+	pBoolData[2] = false;
+	pBoolData[3] = false;
+	pCentroid.readSnapshot(reader);
+}
@@ -11,12 +11,17 @@
 
 #include "NASTRAN_General/GRID.h"
 #include "Math/Coordinate.h"
+#include "NASTRAN_General/BDF_Line.h"
+#include "NASTRAN_General/BDF_Tokenizer.h"
+#include "IO/Binary_Writer.h"
+#include "IO/Binary_Reader.h"
 
 #include <iostream>
 #include <vector>
 #include <string>
 #include <stdlib.h>
 #include <map>
+#include <algorithm>
 
 GRID::GRID()
 {
@@ -26,11 +31,11 @@ GRID::GRID()
 /**
  *	@brief	Constructor also parsing Bulk Data File data, runs parse_BDF_data
  *
- *	@param	BDF_data, a string vector containing Bulk Data File input lines
+ *	@param	BDF_data, a BDF_Line vector of the Bulk Data File input lines
  * 	@param 	long_format_flag, a boolean flagging format type
  */
 
-GRID::GRID(std::vector<std::string> BDF_data, bool long_format_flag){
+GRID::GRID(std::vector<BDF_Line> &BDF_data, bool long_format_flag){
 	parse_BDF_data(BDF_data, long_format_flag);
 }
 
@@ -49,37 +54,23 @@ GRID::~GRID()
 			File has a short and a long format recognised by NASTRAN, the flag 
 			modifies how the input data is parsed for these occurences.
  *
- *	@param	BDF_data, a string vector containing Bulk Data File input lines
+ *	@param	BDF_data, a BDF_Line vector of the Bulk Data File input lines
  * 	@param 	long_format_flag, a boolean flagging format type
  *	@return	void
  */
 
-void GRID::parse_BDF_data(std::vector<std::string> BDF_data, bool long_format_flag)
+void GRID::parse_BDF_data(std::vector<BDF_Line> &BDF_data, bool long_format_flag)
 {
-	// Initiate a string vector to store split data
-	std::vector<std::string> LineData;
-	if (!long_format_flag) {
-		// Short Format, data fields every 8 characters (80 chars max)
-		for (int i = 8; i < 72; i += 8) {
-			LineData.push_back(BDF_data[0].substr(i, 8));
-		}
-
-	} else {
-		// Long Format, data fields every 16 characters after inital 8 characters (80 chars max)
-		for (int i = 0; i < BDF_data.size(); i++) {
-			for (int j = 8; j < 72; j += 16) {
-				LineData.push_back(BDF_data[i].substr(j, 16));
-			}
-		}
-	}
+	// Split the card into fixed width fields, no data is copied
+	BDF_Tokenizer fields(BDF_data, long_format_flag);
 	// Parse Grid ID and Ref Coordinate ID
-	for (int i = 0; i < 2; i++) { pLongData[i] = atol(LineData[i].c_str());	}
+	for (int i = 0; i < 2; i++) { pLongData[i] = fields.field(i).to_long();	}
 	// Parse grid coordinates
 	double coords[3];
-	for (int i = 0; i < 3; i++) { coords[i] = atof(check_exp(LineData[i + 2]).c_str());	}
+	for (int i = 0; i < 3; i++) { coords[i] = fields.field(i + 2).to_double();	}
 	pCoordinate.set_coordinates(coords[0], coords[1], coords[2]);
 	// Parse Analysis Coordinate ID
-	pLongData[2] = atol(LineData[5].c_str());
+	pLongData[2] = fields.field(5).to_long();
 }
 
 /**
@@ -205,6 +196,53 @@ bool GRID::addRBE3_Connect(unsigned long ElementID)
 	return true;
 }
 
+/**
+ *	@brief	Removes an element ID from a GRID connectivity list
+ *
+ *	@param	List, the connectivity list
+ *	@param	ElementID, an unsigned long of the element ID to remove
+ *	@return	bool, returns true if the element was in the list
+ */
+
+static bool removeConnect(std::vector<unsigned long> &List, unsigned long ElementID)
+{
+	for (int i = 0; i < List.size(); i++) {
+		if (List[i] == ElementID) {
+			List.erase(List.begin() + i);
+			return true;
+		}
+	}
+	return false;
+}
+
+bool GRID::removeCQUAD_Connect(unsigned long ElementID)
+{
+	return removeConnect(pCQUAD_List, ElementID);
+}
+
+bool GRID::removeCBUSH_Connect(unsigned long ElementID)
+{
+	return removeConnect(pCBUSH_List, ElementID);
+}
+
+bool GRID::removeRBE2_Connect(unsigned long ElementID)
+{
+	return removeConnect(pRBE2_List, ElementID);
+}
+
+bool GRID::removeRBE3_Connect(unsigned long ElementID)
+{
+	return removeConnect(pRBE3_List, ElementID);
+}
+
+void GRID::sortConnect()
+{
+	std::sort(pCQUAD_List.begin(), pCQUAD_List.end());
+	std::sort(pCBUSH_List.begin(), pCBUSH_List.end());
+	std::sort(pRBE2_List.begin(), pRBE2_List.end());
+	std::sort(pRBE3_List.begin(), pRBE3_List.end());
+}
+
 std::vector<unsigned long> GRID::getRBE2_List()
 {
 	return pRBE2_List;
@@ -342,25 +380,22 @@ double GRID::operator()(int i)
 	}
 }
 
-std::string GRID::check_exp(std::string &str)
+void GRID::writeSnapshot(Binary_Writer &writer)
 {
-    std::size_t first = str.find_first_not_of(' ');
-    if (first == std::string::npos)
-        return "";
-    std::size_t last = str.find_last_not_of(' ');
-	std::string tempStr = str.substr(first, (last-first+1));
-    // Check for NASTRAN exponent
-	std::size_t exp = tempStr.find_first_of('-', 1);
-	if (exp == std::string::npos) {
-		exp = tempStr.find_first_of('+', 1);
-	}
-	// Insert 'E' if exponent is found
-	if (exp != std::string::npos) {
-		std::size_t posEbig = tempStr.find_first_of('E');
-		std::size_t posEsma = tempStr.find_first_of('e');
-		if (posEbig == std::string::npos && posEsma == std::string::npos) {
-			tempStr.insert(exp, "E");
-		}
-	}
-	return tempStr;
+	for (int i = 0; i < 3; i++) { writer.write_ulong(pLongData[i]); }
+	pCoordinate.writeSnapshot(writer);
+	writer.write_ulongs(pCQUAD_List);
+	writer.write_ulongs(pCBUSH_List);
+	writer.write_ulongs(pRBE2_List);
+	writer.write_ulongs(pRBE3_List);
+}
+
+void GRID::readSnapshot(Binary_Reader &reader)
+{
+	for (int i = 0; i < 3; i++) { pLongData[i] = reader.read_ulong(); }
+	pCoordinate.readSnapshot(reader);
+	reader.read_ulongs(pCQUAD_List);
+	reader.read_ulongs(pCBUSH_List);
+	reader.read_ulongs(pRBE2_List);
+	reader.read_ulongs(pRBE3_List);
 }
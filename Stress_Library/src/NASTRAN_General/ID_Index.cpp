@@ -0,0 +1,114 @@
+/**
+ *
+ * @file		ID_Index.cpp
+ * @author		Matt Guimarey
+ * @date		17/10/2026
+ * @version		1.0
+ *
+ * This class maps the IDs of a frozen set of model entries to dense indices
+ *
+ */
+
+#include "NASTRAN_General/ID_Index.h"
+
+#include <vector>
+#include <algorithm>
+
+#define ID_INDEX_HASH_MULTIPLIER 0x9E3779B97F4A7C15ull	// Fibonacci hashing multiplier, 2^64 / golden ratio
+
+ID_Index::ID_Index()
+{
+	pShift = 64;
+}
+
+ID_Index::~ID_Index()
+{
+
+}
+
+/**
+ *	@brief	Builds the index from a list of IDs. The hash table has at least twice as many
+ *			slots as IDs, a power of two, and is filled by linear probing. Model IDs are
+ *			often numbered in runs, so the ID is multiplied by a Fibonacci constant and the
+ *			top bits of the product give the slot to spread the runs over the table.
+ *
+ *	@param	IDs, the IDs in ascending order with no repeats
+ *	@param	Hashed, a bool flagging whether a hash table is built
+ *	@return	void
+ */
+
+void ID_Index::build(const std::vector<unsigned long> &IDs, bool Hashed)
+{
+	pIDs = IDs;
+	std::vector<unsigned long>().swap(pSlots);
+	pShift = 64;
+	if (!Hashed || pIDs.empty()) {
+		return;
+	}
+	std::size_t slotCount = 1;
+	while (slotCount < 2 * pIDs.size()) {
+		slotCount <<= 1;
+		pShift--;
+	}
+	pSlots.assign(slotCount, 0);
+	for (std::size_t i = 0; i < pIDs.size(); i++) {
+		std::size_t slot = (std::size_t)((pIDs[i] * ID_INDEX_HASH_MULTIPLIER) >> pShift);
+		while (pSlots[slot] != 0) {
+			slot = (slot + 1) & (slotCount - 1);
+		}
+		pSlots[slot] = i + 1;
+	}
+}
+
+/**
+ *	@brief	Finds the dense index of an ID, from the hash table if one was built and by a
+ *			binary search of the sorted IDs otherwise.
+ *
+ *	@param	ID, the ID to find
+ *	@param	Index, set to the dense index of the ID
+ *	@return	bool, false if the ID is not in the index
+ */
+
+bool ID_Index::find(unsigned long ID, unsigned long &Index) const
+{
+	if (!pSlots.empty()) {
+		std::size_t mask = pSlots.size() - 1;
+		std::size_t slot = (std::size_t)((ID * ID_INDEX_HASH_MULTIPLIER) >> pShift);
+		while (pSlots[slot] != 0) {
+			if (pIDs[pSlots[slot] - 1] == ID) {
+				Index = pSlots[slot] - 1;
+				return true;
+			}
+			slot = (slot + 1) & mask;
+		}
+		return false;
+	}
+	std::vector<unsigned long>::const_iterator ID_it = std::lower_bound(pIDs.begin(), pIDs.end(), ID);
+	if (ID_it == pIDs.end() || *ID_it != ID) {
+		return false;
+	}
+	Index = ID_it - pIDs.begin();
+	return true;
+}
+
+unsigned long ID_Index::id_at(unsigned long Index) const
+{
+	return pIDs[Index];
+}
+
+unsigned long ID_Index::size() const
+{
+	return pIDs.size();
+}
+
+bool ID_Index::is_hashed() const
+{
+	return !pSlots.empty();
+}
+
+void ID_Index::clear()
+{
+	std::vector<unsigned long>().swap(pIDs);
+	std::vector<unsigned long>().swap(pSlots);
+	pShift = 64;
+}
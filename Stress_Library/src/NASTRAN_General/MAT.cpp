@@ -10,6 +10,11 @@
  */
 
 #include "NASTRAN_General/MAT.h"
+#include "NASTRAN_General/BDF_Line.h"
+#include "NASTRAN_General/BDF_Tokenizer.h"
+#include "NASTRAN_General/BDF_Field.h"
+#include "IO/Binary_Writer.h"
+#include "IO/Binary_Reader.h"
 
 #include <iostream>
 #include <vector>
@@ -24,11 +29,11 @@ MAT::MAT()
 /**
  *	@brief	Constructor also parsing Bulk Data File data, runs parse_BDF_data
  *
- *	@param	BDF_Data, a string vector containing Bulk Data File input lines
+ *	@param	BDF_Data, a BDF_Line vector of the Bulk Data File input lines
  * 	@param 	LongFormatFlag, a boolean flagging format type
  */
 
-MAT::MAT(std::vector<std::string> BDF_Data, bool LongFormatFlag)
+MAT::MAT(std::vector<BDF_Line> &BDF_Data, bool LongFormatFlag)
 {
 	pMaterialType = 0;
 	parseBDFData(BDF_Data, LongFormatFlag);
@@ -44,83 +49,54 @@ MAT::~MAT()
 			File has a short and a long format recognised by NASTRAN, the flag 
 			modifies how the input data is parsed for these occurences.
  *
- *	@param	BDF_Data, a string vector containing Bulk Data File input lines
+ *	@param	BDF_Data, a BDF_Line vector of the Bulk Data File input lines
  * 	@param 	LongFormatFlag, a boolean flagging format type
  *	@return	void
  */
 
-void MAT::parseBDFData(std::vector<std::string> BDF_Data, bool LongFormatFlag)
+void MAT::parseBDFData(std::vector<BDF_Line> &BDF_Data, bool LongFormatFlag)
 {
-	std::vector<std::string> LineData;	///< String vector to store seperated line entries for parsing
-	if (!LongFormatFlag) {
-		// Short Format, data fields every 8 characters (80 chars max)
-		LineData.push_back(BDF_Data[0].substr(0, 8));
-		for (int i = 0; i < BDF_Data.size(); i++) {
-			for (int j = 8; j < 72; j += 8) {
-				LineData.push_back(BDF_Data[i].substr(j, 8));
-			}
-		}
-		// MAT1 card will may have insufficient number of input lines, add extra data to ensure sufficient size in LineData
-		if (BDF_Data.size() < 2) {
-			for (int i = 0; i < 2; i++) {
-				LineData.push_back("");
-			}
-		}
-	} else {
-		// Long Format, data fields every 16 characters after inital 8 characters (80 chars max)
-		LineData.push_back(BDF_Data[0].substr(0, 8));
-		for (int i = 0; i < BDF_Data.size(); i++) {
-			for (int j = 8; j < 72; j += 16) {
-				LineData.push_back(BDF_Data[i].substr(j, 16));
-			}
-		}
-		// MAT1 card will may have insufficient number of input lines, add extra data to ensure sufficient size in LineData
-		if (BDF_Data.size() < 3) {
-			for (int i = 0; i < 2; i++) {
-				LineData.push_back("");
-			}
-		}		
-	}
+	// Split the card into fixed width fields, no data is copied
+	BDF_Tokenizer fields(BDF_Data, LongFormatFlag);
 	// Enter Material ID
-	std::string str = check_exp(LineData[0]);
-	pMaterialID = atol(LineData[1].c_str());
-	if (str.compare("MAT1") == 0 || str.compare("MAT1*") == 0) {
+	BDF_Field name = fields.name();
+	pMaterialID = fields.field(0).to_long();
+	if (name.compare("MAT1") || name.compare("MAT1*")) {
 		// Isotropic Material -> MAT1 Card
 		pMaterialType = 1;
-		pDoubleData[0] = pDoubleData[1] = atof(check_exp(LineData[2]).c_str());
-		pDoubleData[2] = atof(check_exp(LineData[4]).c_str());
-		str = check_exp(LineData[3]);
-		pDoubleData[3] = atof(str.c_str());
-		if (str.compare("") == 0) {
+		pDoubleData[0] = pDoubleData[1] = fields.field(1).to_double();
+		pDoubleData[2] = fields.field(3).to_double();
+		BDF_Field field = fields.field(2);
+		pDoubleData[3] = field.to_double();
+		if (field.is_blank()) {
 			pDoubleData[4] = pDoubleData[5] = -1.0;
 		} else {
-			pDoubleData[4] = pDoubleData[5] = atof(str.c_str());
+			pDoubleData[4] = pDoubleData[5] = field.to_double();
 		}
-		pDoubleData[6] = atof(check_exp(LineData[5]).c_str());
-		pDoubleData[7] = pDoubleData[8] = atof(check_exp(LineData[6]).c_str());
-	} else if (str.compare("MAT8") == 0 || str.compare("MAT8*") == 0) {
+		pDoubleData[6] = fields.field(4).to_double();
+		pDoubleData[7] = pDoubleData[8] = fields.field(5).to_double();
+	} else if (name.compare("MAT8") || name.compare("MAT8*")) {
 		// Orthotropic Material
 		pMaterialType = 2;
 		for (int i = 0; i < 9; i++) {
+			BDF_Field field = fields.field(i + 1);
 			switch (i) {
 				case 1: case 2:
-					str = check_exp(LineData[i + 2]);
-					if (str.compare("") == 0) {
+					if (field.is_blank()) {
 						pDoubleData[i] = 0.001;
 					} else {
-						pDoubleData[i] = atof(str.c_str());
+						pDoubleData[i] = field.to_double();
 					}
 					break;
 				case 4: case 5:
-					str = check_exp(LineData[i + 2]);
-					if (str.compare("") == 0) {
+					if (field.is_blank()) {
 						pDoubleData[i] = -1.0;
 					} else {
-						pDoubleData[i] = atof(str.c_str());
+						pDoubleData[i] = field.to_double();
 					}
 					break;
 				default:
-					pDoubleData[i] = atof(check_exp(LineData[i + 2]).c_str());
+					pDoubleData[i] = field.to_double();
 			}
 		}
 		
@@ -168,31 +144,16 @@ double MAT::operator[] (unsigned int i)
 	}
 }
 
-
-std::string MAT::check_exp(std::string& str)
+void MAT::writeSnapshot(Binary_Writer &writer)
 {
-	std::string tempStr = str;
-    std::size_t first = str.find_first_not_of(' ');
-    if (first == std::string::npos) {
-		return "";
-	} else {
-		while (tempStr.find_first_of(' ') != std::string::npos) {
-			tempStr.erase(tempStr.find_first_of(' '), 1);
-		}
-	}
-    // Check for NASTRAN exponent
-	std::size_t exp = tempStr.find_first_of('-', 1);
-	if (exp == std::string::npos) {
-		exp = tempStr.find_first_of('+', 1);
-	}
-	// Insert 'E' if exponent is found
-	if (exp != std::string::npos) {
-		std::size_t posEbig = tempStr.find_first_of('E');
-		std::size_t posEsma = tempStr.find_first_of('e');
-		if (posEbig == std::string::npos && posEsma == std::string::npos) {
-			tempStr.insert(exp, "E");
-		}
-	}
-	return tempStr;
+	writer.write_ulong(pMaterialID);
+	for (int i = 0; i < 9; i++) { writer.write_double(pDoubleData[i]); }
+	writer.write_ulong(pMaterialType);
 }
 
+void MAT::readSnapshot(Binary_Reader &reader)
+{
+	pMaterialID = reader.read_ulong();
+	for (int i = 0; i < 9; i++) { pDoubleData[i] = reader.read_double(); }
+	pMaterialType = reader.read_ulong();
+}
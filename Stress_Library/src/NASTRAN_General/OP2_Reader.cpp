@@ -0,0 +1,353 @@
+/**
+ *
+ * @file		OP2_Reader.cpp
+ * @author		Matt Guimarey
+ * @date		17/10/2026
+ * @version		1.0
+ *
+ * This class walks the tables and records of a NASTRAN OP2 binary results file held in memory
+ *
+ */
+
+#include "NASTRAN_General/OP2_Reader.h"
+
+#include <string>
+#include <vector>
+#include <map>
+#include <cstring>
+#include <cstddef>
+
+OP2_Record::OP2_Record()
+{
+	clear();
+}
+
+OP2_Record::~OP2_Record()
+{
+
+}
+
+std::size_t OP2_Record::words() const
+{
+	return pStarts.back();
+}
+
+int OP2_Record::int_at(std::size_t i)
+{
+	int value = 0;
+	const char* data = word(i);
+	if (data != NULL) {
+		std::memcpy(&value, data, 4);
+	}
+	return value;
+}
+
+float OP2_Record::float_at(std::size_t i)
+{
+	float value = 0.0f;
+	const char* data = word(i);
+	if (data != NULL) {
+		std::memcpy(&value, data, 4);
+	}
+	return value;
+}
+
+std::string OP2_Record::string_at(std::size_t i, std::size_t count)
+{
+	std::string value;
+	for (std::size_t j = i; value.length() < count; j++) {
+		const char* data = word(j);
+		if (data == NULL) {
+			break;
+		}
+		value.append(data, count - value.length() < 4 ? count - value.length() : 4);
+	}
+	return value;
+}
+
+/**
+ *	@brief	Returns a pointer to a fixed length entry of the record. The data is returned in
+ *			place unless the entry is split across two blocks, in which case its words are
+ *			copied into the scratch array.
+ *
+ *	@param	i, the index of the entry
+ *	@param	numWide, the number of words in each entry
+ *	@param	scratch, a char array of at least 4 * numWide bytes
+ *	@return	const char*, the first byte of the entry, NULL if it runs past the end of the record
+ */
+
+const char* OP2_Record::entry(std::size_t i, int numWide, char* scratch)
+{
+	std::size_t first = i * numWide;
+	if (first + numWide > words()) {
+		return NULL;
+	}
+	const char* data = word(first);
+	if (first + numWide <= pStarts[pBlock + 1]) {
+		return data;
+	}
+	for (int j = 0; j < numWide; j++) {
+		std::memcpy(scratch + 4 * j, word(first + j), 4);
+	}
+	return scratch;
+}
+
+void OP2_Record::clear()
+{
+	pBlocks.clear();
+	pStarts.assign(1, 0);
+	pBlock = 0;
+}
+
+void OP2_Record::add_block(const char* data, std::size_t words)
+{
+	pBlocks.push_back(data);
+	pStarts.push_back(pStarts.back() + words);
+}
+
+/**
+ *	@brief	Finds word i of the record. The search starts from the block of the last word found
+ *			so reading a record in order does not search the block list.
+ *
+ *	@param	i, the index of the word in the record
+ *	@return	const char*, the first byte of the word, NULL past the end of the record
+ */
+
+const char* OP2_Record::word(std::size_t i)
+{
+	if (i >= words()) {
+		return NULL;
+	}
+	if (i < pStarts[pBlock]) {
+		pBlock = 0;
+	}
+	while (i >= pStarts[pBlock + 1]) {
+		pBlock++;
+	}
+	return pBlocks[pBlock] + 4 * (i - pStarts[pBlock]);
+}
+
+OP2_Index::OP2_Index()
+{
+	size = 0;
+}
+
+OP2_Index::~OP2_Index()
+{
+
+}
+
+OP2_Reader::OP2_Reader(const char* begin, const char* end)
+{
+	pBegin = begin;
+	pCursor = begin;
+	pEnd = end;
+	pValid = begin != NULL && begin < end;
+}
+
+OP2_Reader::~OP2_Reader()
+{
+
+}
+
+/**
+ *	@brief	Checks the layout of the file and reads past the file header. Every OP2 file starts
+ *			with a 4 byte Fortran block, a file header starts with a marker of 3 and holds the
+ *			date, tape code and label records followed by -1 and 0 markers. Files written
+ *			without a header start with the name of the first table.
+ *
+ *	@return	bool, false if the file is not a little endian OP2 file with 4 byte words
+ */
+
+bool OP2_Reader::read_header()
+{
+	int marker;
+	if (!pValid || !peek_marker(marker, 0)) {
+		pValid = false;
+		return false;
+	}
+	if (marker != 3) {
+		return true;
+	}
+	for (int i = 0; i < 3; i++) {
+		const char* data;
+		if (!read_marker(marker) || marker <= 0 || !read_block(marker, data)) {
+			return false;
+		}
+	}
+	do {
+		if (!read_marker(marker)) {
+			return false;
+		}
+	} while (marker < 0);
+	pValid = marker == 0;
+	return pValid;
+}
+
+/**
+ *	@brief	Moves to the next table of the file. The table name record is read and the table
+ *			header and subtable name records after it are skipped, the first record read by
+ *			next_record is the first data record of the table.
+ *
+ *	@param	tableName, set to the name of the table with trailing blanks removed
+ *	@return	bool, false at the end of the file or if the file is not well formed
+ */
+
+bool OP2_Reader::next_table(std::string &tableName)
+{
+	int marker;
+	if (!pValid || pCursor >= pEnd) {
+		return false;
+	}
+	// A 0 marker in place of a table name marks the end of the file
+	if (!peek_marker(marker, 0) || marker <= 0) {
+		return false;
+	}
+	OP2_Record record;
+	if (!next_record(record)) {
+		return false;
+	}
+	tableName = record.string_at(0, 8);
+	std::size_t last = tableName.find_last_not_of(' ');
+	tableName.erase(last == std::string::npos ? 0 : last + 1);
+	for (int i = 0; i < 2; i++) {
+		if (!next_record(record)) {
+			return false;
+		}
+	}
+	return true;
+}
+
+/**
+ *	@brief	Reads the next record of the current table. Records are preceded by a marker of
+ *			their length in words and separated by a negative record number marker, which is
+ *			followed by 1 and 0 markers between data records. A record longer than a block
+ *			continues in blocks with further positive markers.
+ *
+ *	@param	record, set to the blocks of the record
+ *	@return	bool, false at the 0 marker closing the table or if the file is not well formed
+ */
+
+bool OP2_Reader::next_record(OP2_Record &record)
+{
+	record.clear();
+	int marker;
+	int ahead[2];
+	while (read_marker(marker)) {
+		if (marker == 0) {
+			return false;
+		}
+		if (marker < 0) {
+			if (peek_marker(ahead[0], 0) && peek_marker(ahead[1], 1) && ahead[0] == 1 && ahead[1] == 0) {
+				read_marker(marker);
+				read_marker(marker);
+			}
+			continue;
+		}
+		const char* data;
+		if (!read_block(marker, data)) {
+			return false;
+		}
+		record.add_block(data, marker);
+		while (peek_marker(marker, 0) && marker > 0) {
+			read_marker(marker);
+			if (!read_block(marker, data)) {
+				return false;
+			}
+			record.add_block(data, marker);
+		}
+		return true;
+	}
+	return false;
+}
+
+bool OP2_Reader::is_valid()
+{
+	return pValid;
+}
+
+std::size_t OP2_Reader::position()
+{
+	return pCursor - pBegin;
+}
+
+bool OP2_Reader::seek(std::size_t offset)
+{
+	if (pBegin == NULL || offset > (std::size_t)(pEnd - pBegin)) {
+		return false;
+	}
+	pCursor = pBegin + offset;
+	return true;
+}
+
+bool OP2_Reader::read_marker(int &marker)
+{
+	if (!peek_marker(marker, 0)) {
+		pValid = false;
+		return false;
+	}
+	pCursor += 12;
+	return true;
+}
+
+/**
+ *	@brief	Reads a marker ahead of the cursor without moving it. A marker is a Fortran block
+ *			holding a single 4 byte integer.
+ *
+ *	@param	marker, set to the value of the marker
+ *	@param	ahead, the number of blocks to look past, 0 for the next block
+ *	@return	bool, false if the block is not a marker or runs past the end of the file
+ */
+
+bool OP2_Reader::peek_marker(int &marker, int ahead)
+{
+	if (!pValid) {
+		return false;
+	}
+	const char* position = pCursor;
+	int length = 0;
+	for (int i = 0; i <= ahead; i++) {
+		if (pEnd - position < 12) {
+			return false;
+		}
+		std::memcpy(&length, position, 4);
+		if (length < 0 || pEnd - position < length + 8) {
+			return false;
+		}
+		if (i < ahead) {
+			position += length + 8;
+		}
+	}
+	if (length != 4) {
+		return false;
+	}
+	std::memcpy(&marker, position + 4, 4);
+	return true;
+}
+
+/**
+ *	@brief	Reads a Fortran block of data words, the length written before and after the block
+ *			must match the expected number of words.
+ *
+ *	@param	words, the number of words expected
+ *	@param	data, set to the first byte of the data in the file
+ *	@return	bool, false if the block does not match or runs past the end of the file
+ */
+
+bool OP2_Reader::read_block(std::size_t words, const char* &data)
+{
+	int length[2];
+	if (!pValid || (std::size_t)(pEnd - pCursor) < 4 * words + 8) {
+		pValid = false;
+		return false;
+	}
+	std::memcpy(&length[0], pCursor, 4);
+	std::memcpy(&length[1], pCursor + 4 + 4 * words, 4);
+	if (length[0] < 0 || (std::size_t)length[0] != 4 * words || length[1] != length[0]) {
+		pValid = false;
+		return false;
+	}
+	data = pCursor + 4;
+	pCursor += 4 * words + 8;
+	return true;
+}
@@ -10,6 +10,10 @@
  */
 
 #include "NASTRAN_General/PBUSH.h"
+#include "NASTRAN_General/BDF_Line.h"
+#include "NASTRAN_General/BDF_Tokenizer.h"
+#include "IO/Binary_Writer.h"
+#include "IO/Binary_Reader.h"
 
 #include <iostream>
 #include <vector>
@@ -24,11 +28,11 @@ PBUSH::PBUSH()
 /**
  *	@brief	Constructor also parsing Bulk Data File data, runs parse_BDF_data
  *
- *	@param	BDF_Data, a string vector containing Bulk Data File input lines
+ *	@param	BDF_Data, a BDF_Line vector of the Bulk Data File input lines
  * 	@param 	LongFormatFlag, a boolean flagging format type
  */
 
-PBUSH::PBUSH(std::vector<std::string> BDF_Data, bool LongFormatFlag)
+PBUSH::PBUSH(std::vector<BDF_Line> &BDF_Data, bool LongFormatFlag)
 {
 	parseBDFData(BDF_Data, LongFormatFlag);
 }
@@ -43,36 +47,22 @@ PBUSH::~PBUSH()
 			File has a short and a long format recognised by NASTRAN, the flag 
 			modifies how the input data is parsed for these occurences.
  *
- *	@param	BDF_Data, a string vector containing Bulk Data File input lines
+ *	@param	BDF_Data, a BDF_Line vector of the Bulk Data File input lines
  * 	@param 	LongFormatFlag, a boolean flagging format type
  *	@return	void
  */
 
-void PBUSH::parseBDFData(std::vector<std::string> BDF_Data, bool LongFormatFlag)
+void PBUSH::parseBDFData(std::vector<BDF_Line> &BDF_Data, bool LongFormatFlag)
 {
-	std::vector<std::string> LineData;	///< String vector to store seperated line entries for parsing
-	if (!LongFormatFlag) {
-		// Short Format, data fields every 8 characters (80 chars max)
-		for (int i = 0; i < BDF_Data.size(); i++) {
-			for (int j = 8; j < 72; j += 8) {
-				LineData.push_back(BDF_Data[i].substr(j, 8));
-			}		
-		}
-	} else {
-		// Long Format, data fields every 16 characters after inital 8 characters (80 chars max)
-		for (int i = 0; i < BDF_Data.size(); i++) {
-			for (int j = 8; j < 72; j += 16) {
-				LineData.push_back(BDF_Data[i].substr(j, 16));
-			}		
-		}
-	}
+	// Split the card into fixed width fields, no data is copied
+	BDF_Tokenizer fields(BDF_Data, LongFormatFlag);
 	// Parse property ID
-	pLongData[0] = atol(LineData[0].c_str());
+	pLongData[0] = fields.field(0).to_long();
 	// Parse K Values
-	for (int i = 1; i < LineData.size(); i += 8) {
-		if (check_exp(LineData[i]).compare("K") == 0) {
+	for (int i = 1; i < fields.size(); i += 8) {
+		if (fields.field(i).compare("K")) {
 			for (int j = 0; j < 6; j++) {
-				pDoubleData[j] = atof(check_exp(LineData[i + j + 1]).c_str());
+				pDoubleData[j] = fields.field(i + j + 1).to_double();
 			}
 		}
 	}
@@ -107,25 +97,14 @@ double PBUSH::operator[] (unsigned int i)
 	}
 }
 
-std::string PBUSH::check_exp(std::string& str)
+void PBUSH::writeSnapshot(Binary_Writer &writer)
 {
-    std::size_t first = str.find_first_not_of(' ');
-    if (first == std::string::npos)
-        return "";
-    std::size_t last = str.find_last_not_of(' ');
-	std::string tempStr = str.substr(first, (last-first+1));
-    // Check for NASTRAN exponent
-	std::size_t exp = tempStr.find_first_of('-', 1);
-	if (exp == std::string::npos) {
-		exp = tempStr.find_first_of('+', 1);
-	}
-	// Insert 'E' if exponent is found
-	if (exp != std::string::npos) {
-		std::size_t posEbig = tempStr.find_first_of('E');
-		std::size_t posEsma = tempStr.find_first_of('e');
-		if (posEbig == std::string::npos && posEsma == std::string::npos) {
-			tempStr.insert(exp, "E");
-		}
-	}
-	return tempStr;
+	writer.write_ulong(pLongData[0]);
+	for (int i = 0; i < 6; i++) { writer.write_double(pDoubleData[i]); }
+}
+
+void PBUSH::readSnapshot(Binary_Reader &reader)
+{
+	pLongData[0] = reader.read_ulong();
+	for (int i = 0; i < 6; i++) { pDoubleData[i] = reader.read_double(); }
 }
@@ -12,6 +12,11 @@
 
 #include "NASTRAN_General/PCOMP.h"
 #include "NASTRAN_General/MAT.h"
+#include "NASTRAN_General/BDF_Line.h"
+#include "NASTRAN_General/BDF_Tokenizer.h"
+#include "NASTRAN_General/BDF_Field.h"
+#include "IO/Binary_Writer.h"
+#include "IO/Binary_Reader.h"
 
 #include <iostream>
 #include <vector>
@@ -38,13 +43,21 @@ PCOMP::PCOMP()
 /**
  *	@brief	Constructor also parsing Bulk Data File data, runs parse_BDF_data
  *
- *	@param	BDF_Data, a string vector containing Bulk Data File input lines
+ *	@param	BDF_Data, a BDF_Line vector of the Bulk Data File input lines
  * 	@param 	LongFormatFlag, a boolean flagging format type
  */
 
-PCOMP::PCOMP(std::vector<std::string> BDF_Data, bool LongFormatFlag)
+PCOMP::PCOMP(std::vector<BDF_Line> &BDF_Data, bool LongFormatFlag)
 {
-	PCOMP();
+	pLaminateValues[0] = 0;
+	pLaminateValues[1] = 0;
+	for (int i = 0; i < 3; i++) {
+		for (int j = 0; j < 3; j++) {
+			A_Matrix[i][j] = 0.0;
+			B_Matrix[i][j] = 0.0;
+			D_Matrix[i][j] = 0.0;
+		}
+	}
 	parseBDFData(BDF_Data, LongFormatFlag);
 }
 
@@ -58,64 +71,42 @@ PCOMP::~PCOMP()
 			File has a short and a long format recognised by NASTRAN, the flag 
 			modifies how the input data is parsed for these occurences.
  *
- *	@param	BDF_Data, a string vector containing Bulk Data File input lines
+ *	@param	BDF_Data, a BDF_Line vector of the Bulk Data File input lines
  * 	@param 	LongFormatFlag, a boolean flagging format type
  *	@return	void
  */
 
-void PCOMP::parseBDFData(std::vector<std::string> BDF_Data, bool LongFormatFlag)
+void PCOMP::parseBDFData(std::vector<BDF_Line> &BDF_Data, bool LongFormatFlag)
 {
-	std::vector<std::string> LineData;	///< String vector to store seperated line entries for parsing
-	std::vector<std::string> PlyData;	///< String vector to store seperated ply entries for parsing
-	if (!LongFormatFlag) {
-		// Short Format, data fields every 8 characters (80 chars max)
-		for (int i = 8; i < 72; i += 8) {
-			LineData.push_back(BDF_Data[0].substr(i, 8));
-		}
-		for (int i = 1; i < BDF_Data.size(); i++) {
-			for (int j = 8; j < 72; j += 8) {
-				PlyData.push_back(BDF_Data[i].substr(j, 8));
-			}	
-		}
-	} else {
-		// Long Format, data fields every 16 characters after inital 8 characters (80 chars max)
-		for (int i = 0; i < 2; i++) {
-			for (int j = 8; j < 72; j += 16) {
-				LineData.push_back(BDF_Data[i].substr(j, 16));
-			}	
-		}			
-		for (int i = 2; i < BDF_Data.size(); i++) {
-			for (int j = 8; j < 72; j += 16) {
-				PlyData.push_back(BDF_Data[i].substr(j, 16));
-			}	
-		}		
-	}
-	pPropertyID = atol(LineData[0].c_str());
-	std::string str = check_exp(LineData[1]);
-	if (str.compare("") == 0) {
+	// Split the card into fixed width fields, no data is copied
+	BDF_Tokenizer fields(BDF_Data, LongFormatFlag);
+	pPropertyID = fields.field(0).to_long();
+	BDF_Field field = fields.field(1);
+	if (field.is_blank()) {
 		pZOff = -0.5;
 	} else {
-		pZOff = atof(str.c_str());
+		pZOff = field.to_double();
 	}
-	str = check_exp(LineData[7]);
-	if (str.compare("SYM") == 0) {
+	field = fields.field(7);
+	if (field.compare("SYM")) {
 		pLaminateValues[0] = 1;
 	}
-	if (str.compare("SMCORE") == 0) {
+	if (field.compare("SMCORE")) {
 		pLaminateValues[0] = 2;
-	}	
-	for (int i = 0; i < PlyData.size(); i += 8) {
-		if (check_exp(PlyData[i + 2]).compare("") != 0) {
+	}
+	// Ply data follows the first 8 fields, two plies per 8 fields
+	for (std::size_t i = 8; i < fields.size(); i += 8) {
+		if (!fields.field(i + 2).is_blank()) {
 			pLaminateValues[1]++;
-			pMaterialID.push_back(atol(PlyData[i].c_str()));
-			pThickness.push_back(atof(check_exp(PlyData[i + 1]).c_str()));
-			pOrientation.push_back(atof(check_exp(PlyData[i + 2]).c_str()));
+			pMaterialID.push_back(fields.field(i).to_long());
+			pThickness.push_back(fields.field(i + 1).to_double());
+			pOrientation.push_back(fields.field(i + 2).to_double());
 		}
-		if (check_exp(PlyData[i + 6]).compare("") != 0) {
+		if (!fields.field(i + 6).is_blank()) {
 			pLaminateValues[1]++;
-			pMaterialID.push_back(atol(PlyData[i + 4].c_str()));
-			pThickness.push_back(atof(check_exp(PlyData[i + 5]).c_str()));
-			pOrientation.push_back(atof(check_exp(PlyData[i + 6]).c_str()));
+			pMaterialID.push_back(fields.field(i + 4).to_long());
+			pThickness.push_back(fields.field(i + 5).to_double());
+			pOrientation.push_back(fields.field(i + 6).to_double());
 		}
 	}
 	switch (pLaminateValues[0]) {
@@ -247,26 +238,40 @@ double PCOMP::operator[] (unsigned int i)
 	}	
 }
 
-
-std::string PCOMP::check_exp(std::string& str)
+void PCOMP::writeSnapshot(Binary_Writer &writer)
 {
-    std::size_t first = str.find_first_not_of(' ');
-    if (first == std::string::npos)
-        return "";
-    std::size_t last = str.find_last_not_of(' ');
-	std::string tempStr = str.substr(first, (last-first+1));
-    // Check for NASTRAN exponent
-	std::size_t exp = tempStr.find_first_of('-', 1);
-	if (exp == std::string::npos) {
-		exp = tempStr.find_first_of('+', 1);
+	writer.write_ulong(pPropertyID);
+	writer.write_double(pZOff);
+	writer.write_ulong(pLaminateValues[0]);
+	writer.write_ulong(pLaminateValues[1]);
+	writer.write_ulongs(pMaterialID);
+	writer.write_doubles(pThickness);
+	writer.write_doubles(pOrientation);
+	for (int i = 0; i < 3; i++) {
+		for (int j = 0; j < 3; j++) {
+			writer.write_double(A_Matrix[i][j]);
+			writer.write_double(B_Matrix[i][j]);
+			writer.write_double(D_Matrix[i][j]);
+		}
 	}
-	// Insert 'E' if exponent is found
-	if (exp != std::string::npos) {
-		std::size_t posEbig = tempStr.find_first_of('E');
-		std::size_t posEsma = tempStr.find_first_of('e');
-		if (posEbig == std::string::npos && posEsma == std::string::npos) {
-			tempStr.insert(exp, "E");
+	for (int i = 0; i < 6; i++) { writer.write_double(Laminate_Stiffness[i]); }
+}
+
+void PCOMP::readSnapshot(Binary_Reader &reader)
+{
+	pPropertyID = reader.read_ulong();
+	pZOff = reader.read_double();
+	pLaminateValues[0] = reader.read_ulong();
+	pLaminateValues[1] = reader.read_ulong();
+	reader.read_ulongs(pMaterialID);
+	reader.read_doubles(pThickness);
+	reader.read_doubles(pOrientation);
+	for (int i = 0; i < 3; i++) {
+		for (int j = 0; j < 3; j++) {
+			A_Matrix[i][j] = reader.read_double();
+			B_Matrix[i][j] = reader.read_double();
+			D_Matrix[i][j] = reader.read_double();
 		}
 	}
-	return tempStr;
+	for (int i = 0; i < 6; i++) { Laminate_Stiffness[i] = reader.read_double(); }
 }
@@ -10,6 +10,11 @@
  */
 
 #include "NASTRAN_General/PSHELL.h"
+#include "NASTRAN_General/BDF_Line.h"
+#include "NASTRAN_General/BDF_Tokenizer.h"
+#include "NASTRAN_General/BDF_Field.h"
+#include "IO/Binary_Writer.h"
+#include "IO/Binary_Reader.h"
 
 #include <iostream>
 #include <vector>
@@ -24,11 +29,11 @@ PSHELL::PSHELL()
 /**
  *	@brief	Constructor also parsing Bulk Data File data, runs parse_BDF_data
  *
- *	@param	BDF_Data, a string vector containing Bulk Data File input lines
+ *	@param	BDF_Data, a BDF_Line vector of the Bulk Data File input lines
  * 	@param 	LongFormatFlag, a boolean flagging format type
  */
 
-PSHELL::PSHELL(std::vector<std::string> BDF_Data, bool LongFormatFlag)
+PSHELL::PSHELL(std::vector<BDF_Line> &BDF_Data, bool LongFormatFlag)
 {
 	parseBDFData(BDF_Data, LongFormatFlag);
 }
@@ -43,56 +48,43 @@ PSHELL::~PSHELL()
 			File has a short and a long format recognised by NASTRAN, the flag 
 			modifies how the input data is parsed for these occurences.
  *
- *	@param	BDF_Data, a string vector containing Bulk Data File input lines
+ *	@param	BDF_Data, a BDF_Line vector of the Bulk Data File input lines
  * 	@param 	LongFormatFlag, a boolean flagging format type
  *	@return	void
  */
 
-void PSHELL::parseBDFData(std::vector<std::string> BDF_Data, bool LongFormatFlag)
+void PSHELL::parseBDFData(std::vector<BDF_Line> &BDF_Data, bool LongFormatFlag)
 {
-	std::vector<std::string> LineData;	///< String vector to store seperated line entries for parsing
-	if (!LongFormatFlag) {
-		// Short Format, data fields every 8 characters (80 chars max)
-		for (int i = 8; i < 72; i += 8) {
-			LineData.push_back(BDF_Data[0].substr(i, 8));
-		}
-
-	} else {
-		// Long Format, data fields every 16 characters after inital 8 characters (80 chars max)
-        for (int i = 0; i < BDF_Data.size(); i++) {
-            for (int j = 8; j < 72; j += 16) {
-                LineData.push_back(BDF_Data[i].substr(j, 16));
-            }
-        }
-	}
+	// Split the card into fixed width fields, no data is copied
+	BDF_Tokenizer fields(BDF_Data, LongFormatFlag);
 	// Parse Longs
-	for (int i = 0; i < 2; i++) { pLongData[i] = atol(LineData[i].c_str()); }
-	std::string str = check_exp(LineData[3]);
-	if (str.compare("") == 0) {
+	for (int i = 0; i < 2; i++) { pLongData[i] = fields.field(i).to_long(); }
+	BDF_Field field = fields.field(3);
+	if (field.is_blank()) {
 		pLongData[2] = pLongData[1];
 	} else {
-		pLongData[2] = atol(str.c_str());
+		pLongData[2] = field.to_long();
 	}
-	str = check_exp(LineData[5]);
-	if (str.compare("") == 0) {
+	field = fields.field(5);
+	if (field.is_blank()) {
 		pLongData[3] = pLongData[1];
 	} else {
-		pLongData[3] = atol(str.c_str());
+		pLongData[3] = field.to_long();
 	}
 	// Parse doubles
-	pDoubleData[0] = atof(check_exp(LineData[2]).c_str());
-	str = check_exp(LineData[4]);
-	if (str.compare("") == 0) {
+	pDoubleData[0] = fields.field(2).to_double();
+	field = fields.field(4);
+	if (field.is_blank()) {
 		pDoubleData[1] = 1.0;
 	} else {
-		pDoubleData[1] = atof(str.c_str());
+		pDoubleData[1] = field.to_double();
 	}
-	str = check_exp(LineData[6]);
-	if (str.compare("") == 0) {
+	field = fields.field(6);
+	if (field.is_blank()) {
 		pDoubleData[2] = 0.833333;
 	} else {
-		pDoubleData[2] = atof(str.c_str());
-	}	
+		pDoubleData[2] = field.to_double();
+	}
 }
 
 /**
@@ -138,26 +130,14 @@ double PSHELL::operator() (unsigned int i)
 	}
 }
 
+void PSHELL::writeSnapshot(Binary_Writer &writer)
+{
+	for (int i = 0; i < 4; i++) { writer.write_ulong(pLongData[i]); }
+	for (int i = 0; i < 3; i++) { writer.write_double(pDoubleData[i]); }
+}
 
-std::string PSHELL::check_exp(std::string& str)
+void PSHELL::readSnapshot(Binary_Reader &reader)
 {
-    std::size_t first = str.find_first_not_of(' ');
-    if (first == std::string::npos)
-        return "";
-    std::size_t last = str.find_last_not_of(' ');
-	std::string tempStr = str.substr(first, (last-first+1));
-    // Check for NASTRAN exponent
-	std::size_t exp = tempStr.find_first_of('-', 1);
-	if (exp == std::string::npos) {
-		exp = tempStr.find_first_of('+', 1);
-	}
-	// Insert 'E' if exponent is found
-	if (exp != std::string::npos) {
-		std::size_t posEbig = tempStr.find_first_of('E');
-		std::size_t posEsma = tempStr.find_first_of('e');
-		if (posEbig == std::string::npos && posEsma == std::string::npos) {
-			tempStr.insert(exp, "E");
-		}
-	}
-	return tempStr;
+	for (int i = 0; i < 4; i++) { pLongData[i] = reader.read_ulong(); }
+	for (int i = 0; i < 3; i++) { pDoubleData[i] = reader.read_double(); }
 }
@@ -0,0 +1,185 @@
+/**
+ *
+ * @file		Ply_Store.cpp
+ * @author		Matt Guimarey
+ * @date		17/10/2026
+ * @version		1.0
+ *
+ * This class stores the punch file ply results of composite elements in columns
+ *
+ */
+
+#include "NASTRAN_General/Ply_Store.h"
+
+#include <vector>
+#include <map>
+#include <cstddef>
+
+#define PLY_STORE_MAX_PLIES 65535	// Plies held per element and subcase, the limit of the ply count
+
+Ply_Store::Ply_Store()
+{
+	pComponents = 0;
+	pSinglePrecision = false;
+	pElements = 0;
+}
+
+Ply_Store::Ply_Store(int Components, bool SinglePrecision)
+{
+	pComponents = Components;
+	pSinglePrecision = SinglePrecision;
+	pElements = 0;
+}
+
+Ply_Store::~Ply_Store()
+{
+
+}
+
+unsigned long Ply_Store::add_element()
+{
+	return pElements++;
+}
+
+/**
+ *	@brief	Adds the result values of a ply of an element for a subcase as a new row. The
+ *			subcase is given the next dense index the first time it is found, and its element
+ *			arrays are grown to cover every element added so far when an element past their
+ *			end is written. The plies of an element follow one another in a punch block, so
+ *			the rows of an element are contiguous and only its first row and ply count are
+ *			held per element. A ply already held, or a ply for an element whose rows are not
+ *			the last rows of the subcase, is dropped so the first result read is kept.
+ *
+ *	@param	Index, the dense index of the element returned by add_element
+ * 	@param 	SubcaseID, unsigned long integer of the subcase ID
+ *	@param	Ply, the ply ID
+ *	@param	values, a double array of pComponents result values
+ *	@return	void
+ */
+
+void Ply_Store::add_result(unsigned long Index, unsigned long SubcaseID, unsigned int Ply, const double* values)
+{
+	std::map<unsigned long, unsigned long>::iterator subcase_it = pSubcaseIndex.find(SubcaseID);
+	if (subcase_it == pSubcaseIndex.end()) {
+		subcase_it = pSubcaseIndex.insert(std::pair<unsigned long, unsigned long> (SubcaseID, pFirst.size())).first;
+		pFirst.push_back(std::vector<unsigned long>());
+		pCount.push_back(std::vector<unsigned short>());
+		pPlies.push_back(std::vector<unsigned int>());
+		pLastIndex.push_back(0);
+		if (pSinglePrecision) {
+			pFloats.resize(pFloats.size() + pComponents);
+		} else {
+			pDoubles.resize(pDoubles.size() + pComponents);
+		}
+	}
+	unsigned long subcase = subcase_it->second;
+	std::vector<unsigned long> &first = pFirst[subcase];
+	std::vector<unsigned short> &count = pCount[subcase];
+	std::vector<unsigned int> &plies = pPlies[subcase];
+	if (Index >= first.size()) {
+		first.resize(pElements > Index ? pElements : Index + 1, 0);
+		count.resize(first.size(), 0);
+	}
+	if (first[Index] != 0) {
+		if (pLastIndex[subcase] != Index || count[Index] == PLY_STORE_MAX_PLIES) {
+			return;
+		}
+		for (unsigned long row = first[Index] - 1; row < plies.size(); row++) {
+			if (plies[row] == Ply) {
+				return;
+			}
+		}
+	} else {
+		first[Index] = plies.size() + 1;
+	}
+	pLastIndex[subcase] = Index;
+	count[Index]++;
+	plies.push_back(Ply);
+	for (int i = 0; i < pComponents; i++) {
+		if (pSinglePrecision) {
+			pFloats[subcase * pComponents + i].push_back((float)values[i]);
+		} else {
+			pDoubles[subcase * pComponents + i].push_back(values[i]);
+		}
+	}
+}
+
+unsigned int Ply_Store::ply_count(unsigned long Index, unsigned long SubcaseID) const
+{
+	std::map<unsigned long, unsigned long>::const_iterator subcase_it = pSubcaseIndex.find(SubcaseID);
+	if (subcase_it == pSubcaseIndex.end() || Index >= pCount[subcase_it->second].size()) {
+		return 0;
+	}
+	return pCount[subcase_it->second][Index];
+}
+
+/**
+ *	@brief	Returns a ply result of an element for a subcase. Plies are in the order they were
+ *			added, the order of the punch file.
+ *
+ *	@param	Index, the dense index of the element returned by add_element
+ * 	@param 	SubcaseID, unsigned long integer of the subcase ID
+ *	@param	Position, the position of the ply in the plies of the element, 0 -> ply_count - 1
+ *	@param	Ply, set to the ply ID
+ *	@param	values, a double array set to the pComponents result values
+ *	@return	bool, false if there is no ply at Position
+ */
+
+bool Ply_Store::get_result(unsigned long Index, unsigned long SubcaseID, unsigned int Position, unsigned int &Ply, double* values) const
+{
+	if (Position >= ply_count(Index, SubcaseID)) {
+		return false;
+	}
+	unsigned long subcase = pSubcaseIndex.find(SubcaseID)->second;
+	unsigned long row = pFirst[subcase][Index] - 1 + Position;
+	Ply = pPlies[subcase][row];
+	for (int i = 0; i < pComponents; i++) {
+		if (pSinglePrecision) {
+			values[i] = pFloats[subcase * pComponents + i][row];
+		} else {
+			values[i] = pDoubles[subcase * pComponents + i][row];
+		}
+	}
+	return true;
+}
+
+unsigned long Ply_Store::element_count() const
+{
+	return pElements;
+}
+
+unsigned long Ply_Store::subcase_count() const
+{
+	return pSubcaseIndex.size();
+}
+
+unsigned long Ply_Store::row_count() const
+{
+	unsigned long rows = 0;
+	for (std::size_t i = 0; i < pPlies.size(); i++) {
+		rows += pPlies[i].size();
+	}
+	return rows;
+}
+
+bool Ply_Store::single_precision() const
+{
+	return pSinglePrecision;
+}
+
+void Ply_Store::clear()
+{
+	pElements = 0;
+	clear_results();
+}
+
+void Ply_Store::clear_results()
+{
+	pSubcaseIndex.clear();
+	pFirst.clear();
+	pCount.clear();
+	pPlies.clear();
+	pLastIndex.clear();
+	pFloats.clear();
+	pDoubles.clear();
+}
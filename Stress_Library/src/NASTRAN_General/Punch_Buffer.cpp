@@ -0,0 +1,60 @@
+/**
+ *
+ * @file		Punch_Buffer.cpp
+ * @author		Matt Guimarey
+ * @date		17/10/2026
+ * @version		1.0
+ *
+ * This class defines a buffer of the load cases and force results decoded from a single punch file
+ *
+ */
+
+#include "NASTRAN_General/Punch_Buffer.h"
+#include "NASTRAN_General/LOAD_CASE.h"
+#include "NASTRAN_General/Punch_Index.h"
+
+#include <string>
+#include <vector>
+#include <map>
+
+Punch_Buffer::Punch_Buffer()
+{
+	opened = false;
+	for (int i = 0; i < 4; i++) { resultTypes[i] = false; }
+	subcaseID = 0;
+	indexing = false;
+	listing = false;
+	streamSubcase = 0;
+	decoded = NULL;
+	sequence = 0;
+	nextFile = NULL;
+	readBytes = 0;
+	readSeconds = 0.0;
+	decodeSeconds = 0.0;
+}
+
+Punch_Buffer::Punch_Buffer(std::string FileName)
+{
+	fileName = FileName;
+	opened = false;
+	for (int i = 0; i < 4; i++) { resultTypes[i] = false; }
+	subcaseID = 0;
+	indexing = false;
+	listing = false;
+	streamSubcase = 0;
+	decoded = NULL;
+	sequence = 0;
+	nextFile = NULL;
+	readBytes = 0;
+	readSeconds = 0.0;
+	decodeSeconds = 0.0;
+}
+
+Punch_Buffer::~Punch_Buffer()
+{
+	std::map<unsigned long, LOAD_CASE*>::iterator LOAD_CASE_it;
+	for (LOAD_CASE_it = LOAD_CASE_Map.begin(); LOAD_CASE_it != LOAD_CASE_Map.end(); LOAD_CASE_it++) {
+		delete LOAD_CASE_it->second;
+	}
+	for (int i = 0; i < chunks.size(); i++) { delete chunks[i]; }
+}
@@ -0,0 +1,135 @@
+/**
+ *
+ * @file		Punch_Filter.cpp
+ * @author		Matt Guimarey
+ * @date		17/10/2026
+ * @version		1.0
+ *
+ * This class defines the CQUADs, CBUSHes and subcases whose punch file results are kept
+ *
+ */
+
+#include "NASTRAN_General/Punch_Filter.h"
+
+#include <vector>
+
+Punch_Filter::Punch_Filter()
+{
+	for (int i = 0; i < 3; i++) {
+		pBase[i] = 0;
+		pCount[i] = 0;
+		pSelected[i] = false;
+	}
+}
+
+Punch_Filter::~Punch_Filter()
+{
+
+}
+
+void Punch_Filter::add_CQUAD(unsigned long ElementID)
+{
+	add(0, ElementID);
+}
+
+void Punch_Filter::add_CBUSH(unsigned long ElementID)
+{
+	add(1, ElementID);
+}
+
+void Punch_Filter::add_subcase(unsigned long SubcaseID)
+{
+	add(2, SubcaseID);
+}
+
+bool Punch_Filter::is_empty() const
+{
+	return !pSelected[0] && !pSelected[1] && !pSelected[2];
+}
+
+bool Punch_Filter::has_CQUAD_range(unsigned long FirstID, unsigned long LastID) const
+{
+	return has_range(0, FirstID, LastID);
+}
+
+bool Punch_Filter::has_CBUSH_range(unsigned long FirstID, unsigned long LastID) const
+{
+	return has_range(1, FirstID, LastID);
+}
+
+unsigned long Punch_Filter::CQUAD_size() const
+{
+	return pCount[0];
+}
+
+unsigned long Punch_Filter::CBUSH_size() const
+{
+	return pCount[1];
+}
+
+/**
+ *	@brief	Sets the bit of an ID in the bitmap of a type. The bitmap is extended at either end
+ *			to span the new ID, IDs added in ascending order only extend the end.
+ *
+ *	@param	type, the bitmap type: 0 -> CQUAD, 1 -> CBUSH, 2 -> subcase
+ *	@param	ID, the ID to select
+ *	@return	void
+ */
+
+void Punch_Filter::add(int type, unsigned long ID)
+{
+	std::vector<unsigned long long> &bits = pBits[type];
+	unsigned long base = ID - (ID & 63);
+	if (!pSelected[type]) {
+		pBase[type] = base;
+		pSelected[type] = true;
+	} else if (base < pBase[type]) {
+		bits.insert(bits.begin(), (pBase[type] - base) >> 6, 0ull);
+		pBase[type] = base;
+	}
+	unsigned long bit = ID - pBase[type];
+	if ((bit >> 6) >= bits.size()) {
+		bits.resize((bit >> 6) + 1, 0ull);
+	}
+	if ((bits[bit >> 6] & (1ull << (bit & 63))) == 0) {
+		bits[bit >> 6] |= 1ull << (bit & 63);
+		pCount[type]++;
+	}
+}
+
+/**
+ *	@brief	Returns true if any ID in a range is selected, the bitmap words covering the
+ *			range are tested whole.
+ *
+ *	@param	type, the bitmap type: 0 -> CQUAD, 1 -> CBUSH, 2 -> subcase
+ *	@param	FirstID, the first ID of the range
+ *	@param	LastID, the last ID of the range, included
+ *	@return	bool, true if an ID is selected or no ID of the type has been added
+ */
+
+bool Punch_Filter::has_range(int type, unsigned long FirstID, unsigned long LastID) const
+{
+	if (!pSelected[type]) {
+		return true;
+	}
+	const std::vector<unsigned long long> &bits = pBits[type];
+	unsigned long end = pBase[type] + 64 * bits.size();
+	if (LastID < pBase[type] || FirstID >= end || LastID < FirstID) {
+		return false;
+	}
+	unsigned long first = (FirstID < pBase[type] ? 0 : FirstID - pBase[type]);
+	unsigned long last = (LastID >= end ? end - 1 : LastID) - pBase[type];
+	for (unsigned long word = first >> 6; word <= last >> 6; word++) {
+		unsigned long long mask = ~0ull;
+		if (word == first >> 6) {
+			mask &= ~0ull << (first & 63);
+		}
+		if (word == last >> 6) {
+			mask &= ~0ull >> (63 - (last & 63));
+		}
+		if ((bits[word] & mask) != 0) {
+			return true;
+		}
+	}
+	return false;
+}
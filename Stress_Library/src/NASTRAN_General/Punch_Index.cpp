@@ -0,0 +1,151 @@
+/**
+ *
+ * @file		Punch_Index.cpp
+ * @author		Matt Guimarey
+ * @date		17/10/2026
+ * @version		1.0
+ *
+ * This class defines the sidecar index of the subcase blocks and result entries of a punch file
+ *
+ */
+
+#include "NASTRAN_General/Punch_Index.h"
+#include "IO/Binary_Writer.h"
+#include "IO/Binary_Reader.h"
+
+#include <string>
+#include <vector>
+
+#define PUNCH_SEGMENT_SIZE 64	// Result entries per indexed run
+#define PUNCH_INDEX_MAGIC "FILL_IT_PUNCH_INDEX"
+#define PUNCH_INDEX_VERSION 2	// Increment when the index layout or the result blocks indexed change
+#define PUNCH_INDEX_BLOCK_BYTES 48	// Bytes of a block record before its segments, six ulongs
+#define PUNCH_INDEX_SEGMENT_BYTES 24	// Bytes of a segment record, three ulongs
+
+Punch_Block::Punch_Block()
+{
+	offset = 0;
+	length = 0;
+	entriesEnd = 0;
+	subcaseID = 0;
+	entryCount = 0;
+}
+
+void Punch_Block::add_entry(unsigned long long Offset, unsigned long ElementID)
+{
+	if (entryCount % PUNCH_SEGMENT_SIZE == 0) {
+		Punch_Segment segment;
+		segment.offset = Offset;
+		segment.minID = ElementID;
+		segment.maxID = ElementID;
+		segments.push_back(segment);
+	} else {
+		Punch_Segment &segment = segments.back();
+		if (ElementID < segment.minID) {
+			segment.minID = ElementID;
+		}
+		if (ElementID > segment.maxID) {
+			segment.maxID = ElementID;
+		}
+	}
+	entryCount++;
+}
+
+Punch_Index::Punch_Index()
+{
+	size = 0;
+	modified = 0;
+	hash = 0;
+}
+
+Punch_Index::~Punch_Index()
+{
+
+}
+
+/**
+ *	@brief	Writes the index file, the key of the punch file then each block with its
+ *			segments.
+ *
+ *	@param	fileName, the path of the index file
+ *	@return	bool, false if the file could not be written
+ */
+
+bool Punch_Index::save(std::string fileName)
+{
+	Binary_Writer writer;
+	writer.write_string(PUNCH_INDEX_MAGIC);
+	writer.write_ulong(PUNCH_INDEX_VERSION);
+	writer.write_ulong(size);
+	writer.write_ulong(modified);
+	writer.write_ulong(hash);
+	writer.write_ulong(blocks.size());
+	for (std::size_t i = 0; i < blocks.size(); i++) {
+		Punch_Block &block = blocks[i];
+		writer.write_ulong(block.offset);
+		writer.write_ulong(block.length);
+		writer.write_ulong(block.entriesEnd);
+		writer.write_ulong(block.subcaseID);
+		writer.write_ulong(block.entryCount);
+		writer.write_ulong(block.segments.size());
+		for (std::size_t j = 0; j < block.segments.size(); j++) {
+			writer.write_ulong(block.segments[j].offset);
+			writer.write_ulong(block.segments[j].minID);
+			writer.write_ulong(block.segments[j].maxID);
+		}
+	}
+	return writer.save(fileName);
+}
+
+/**
+ *	@brief	Reads an index file written by save. Blocks and segments are checked to lie in
+ *			the punch file size read from the index, and the block and segment counts to fit
+ *			in the bytes left in the index file before any are allocated.
+ *
+ *	@param	fileName, the path of the index file
+ *	@return	bool, false if the file does not exist, is not an index file of this version or is
+ *			not consistent
+ */
+
+bool Punch_Index::load(std::string fileName)
+{
+	Binary_Reader reader;
+	if (!reader.open(fileName)) {
+		return false;
+	}
+	if (reader.read_string().compare(PUNCH_INDEX_MAGIC) != 0 || reader.read_ulong() != PUNCH_INDEX_VERSION) {
+		return false;
+	}
+	size = reader.read_ulong();
+	modified = reader.read_ulong();
+	hash = reader.read_ulong();
+	unsigned long long blockCount = reader.read_ulong();
+	// Counts are checked against the bytes left before allocating, a damaged index cannot request more records than it holds
+	if (!reader.good() || blockCount > size || blockCount > reader.remaining() / PUNCH_INDEX_BLOCK_BYTES) {
+		return false;
+	}
+	blocks.resize(blockCount);
+	for (std::size_t i = 0; i < blocks.size(); i++) {
+		Punch_Block &block = blocks[i];
+		block.offset = reader.read_ulong();
+		block.length = reader.read_ulong();
+		block.entriesEnd = reader.read_ulong();
+		block.subcaseID = reader.read_ulong();
+		block.entryCount = reader.read_ulong();
+		unsigned long long segmentCount = reader.read_ulong();
+		if (!reader.good() || block.offset > size || block.length > size - block.offset || block.entriesEnd > block.length
+			|| segmentCount > block.entryCount || segmentCount > reader.remaining() / PUNCH_INDEX_SEGMENT_BYTES) {
+			return false;
+		}
+		block.segments.resize(segmentCount);
+		for (std::size_t j = 0; j < block.segments.size(); j++) {
+			block.segments[j].offset = reader.read_ulong();
+			block.segments[j].minID = reader.read_ulong();
+			block.segments[j].maxID = reader.read_ulong();
+			if (block.segments[j].offset > block.entriesEnd) {
+				return false;
+			}
+		}
+	}
+	return reader.good() && reader.at_end();
+}
@@ -0,0 +1,72 @@
+/**
+ *
+ * @file		Punch_Queue.cpp
+ * @author		Matt Guimarey
+ * @date		17/10/2026
+ * @version		1.0
+ *
+ * This class defines a bounded reorder queue passing decoded punch buffers between threads in the order they are stored
+ *
+ */
+
+#include "NASTRAN_General/Punch_Queue.h"
+#include "NASTRAN_General/Punch_Buffer.h"
+
+#include <vector>
+#include <mutex>
+#include <condition_variable>
+
+Punch_Queue::Punch_Queue(std::size_t Capacity)
+{
+	pSlots.assign(Capacity > 0 ? Capacity : 1, (Punch_Buffer*)NULL);
+	pHead = 0;
+}
+
+Punch_Queue::~Punch_Queue()
+{
+
+}
+
+/**
+ *	@brief	Adds a buffer at the slot of its sequence number. The producer sleeps until the
+ *			sequence is less than a whole queue ahead of the head, so at most as many buffers
+ *			as the queue holds are waiting to be stored. Buffers must be queued for decoding in
+ *			sequence order, the buffer at the head is then always decoding or decoded and the
+ *			wait cannot stall the pool.
+ *
+ *	@param	buffer, the buffer to add, its sequence number is not already in the queue
+ *	@return	void
+ */
+
+void Punch_Queue::push(Punch_Buffer* buffer)
+{
+	std::unique_lock<std::mutex> lock(pMutex);
+	while (buffer->sequence >= pHead + pSlots.size()) {
+		pRemoved.wait(lock);
+	}
+	pSlots[buffer->sequence % pSlots.size()] = buffer;
+	if (buffer->sequence == pHead) {
+		pAdded.notify_one();
+	}
+}
+
+/**
+ *	@brief	Removes the buffer with the next sequence number. The consumer sleeps until that
+ *			buffer has been added, buffers added out of order stay in their slots.
+ *
+ *	@return	Punch_Buffer*, the buffer with the next sequence number
+ */
+
+Punch_Buffer* Punch_Queue::pop()
+{
+	std::unique_lock<std::mutex> lock(pMutex);
+	std::size_t slot = pHead % pSlots.size();
+	while (pSlots[slot] == NULL) {
+		pAdded.wait(lock);
+	}
+	Punch_Buffer* buffer = pSlots[slot];
+	pSlots[slot] = NULL;
+	pHead++;
+	pRemoved.notify_all();
+	return buffer;
+}
@@ -0,0 +1,148 @@
+/**
+ *
+ * @file		Punch_Record.cpp
+ * @author		Matt Guimarey
+ * @date		17/10/2026
+ * @version		1.0
+ *
+ * This class decodes the result fields of a punch file result entry
+ *
+ */
+
+#include "NASTRAN_General/Punch_Record.h"
+#include "NASTRAN_General/BDF_Line.h"
+#include "NASTRAN_General/BDF_Field.h"
+
+#include <algorithm>
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__SSE2__)
+#include <emmintrin.h>
+#define PUNCH_RECORD_SSE2
+#endif
+
+#define PUNCH_FIELD_WIDTH 18		// Columns of a result field, the entry ID takes the first field
+#define PUNCH_FIELDS_PER_LINE 3		// Result fields per line
+#define PUNCH_MANTISSA_DECIMALS 6	// Decimals of a punched real
+
+Punch_Record::Punch_Record(const BDF_Line* Lines, int LineCount)
+{
+	pLines = Lines;
+	pLineCount = LineCount;
+}
+
+Punch_Record::~Punch_Record()
+{
+
+}
+
+/**
+ *	@brief	Decodes the result fields of the entry. Each field is tried in the fixed punch
+ *			layout first and decoded as a BDF_Field if it is blank, short or written in any
+ *			other form, so the values are the same as BDF_Field::to_double either way.
+ *
+ *	@param	values, a double array receiving the decoded fields
+ *	@param	count, the number of fields to decode
+ *	@return	void
+ */
+
+void Punch_Record::decode(double* values, int count) const
+{
+	for (int i = 0; i < count; i++) {
+		int line = i / PUNCH_FIELDS_PER_LINE;
+		if (line >= pLineCount) {
+			values[i] = 0.0;
+			continue;
+		}
+		const BDF_Line &lineData = pLines[line];
+		std::size_t column = PUNCH_FIELD_WIDTH * (i % PUNCH_FIELDS_PER_LINE + 1);
+		if (column >= lineData.length()) {
+			values[i] = 0.0;
+			continue;
+		}
+		std::size_t length = std::min<std::size_t>(PUNCH_FIELD_WIDTH, lineData.length() - column);
+		if (!decode_field(lineData.data() + column, length, values[i])) {
+			values[i] = BDF_Field(lineData.data() + column, length).to_double();
+		}
+	}
+}
+
+/**
+ *	@brief	Decodes a field in the layout NASTRAN punches reals, a blank or minus sign,
+ *			d.dddddd, E, the exponent sign and two exponent digits followed by blanks. The
+ *			first 16 columns are checked against the layout and their digits converted in one
+ *			pass with SSE2, the scalar path reads the same columns one at a time. The 7 digit
+ *			mantissa is scaled by a single exact power of ten so the result matches strtod.
+ *
+ *	@param	field, a pointer to the first column of the field
+ *	@param	length, the number of columns of the field on the line, at most 18
+ *	@param	value, set to the decoded real
+ *	@return	bool, false if the field is not in the punch layout
+ */
+
+bool Punch_Record::decode_field(const char* field, std::size_t length, double &value)
+{
+	static const double powers[23] = {1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+		1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+	// "-d.ddddddE+dd" then blanks, a blank in place of a plus mantissa sign
+	if (length < 16 || (field[0] != ' ' && field[0] != '-') || (field[10] != '+' && field[10] != '-')) {
+		return false;
+	}
+	for (std::size_t i = 16; i < length; i++) {
+		if (field[i] != ' ') {
+			return false;
+		}
+	}
+	long mantissa, exponent;
+#ifdef PUNCH_RECORD_SSE2
+	// Digit, separator and blank columns are checked together, the signs were checked above
+	const __m128i bytes = _mm_loadu_si128((const __m128i*)field);
+	const __m128i layout = _mm_setr_epi8(0, 0, '.', 0, 0, 0, 0, 0, 0, 'E', 0, 0, 0, ' ', ' ', ' ');
+	const __m128i digits = _mm_sub_epi8(bytes, _mm_set1_epi8('0'));
+	int isDigit = _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_min_epu8(digits, _mm_set1_epi8(9)), digits));
+	int isLayout = _mm_movemask_epi8(_mm_cmpeq_epi8(bytes, layout));
+	if ((isDigit & 0x19FA) != 0x19FA || (isLayout & 0xE204) != 0xE204) {
+		return false;
+	}
+	// Weighted digit sums of column pairs, columns not holding a digit have a weight of 0
+	const __m128i zero = _mm_setzero_si128();
+	__m128i low = _mm_madd_epi16(_mm_unpacklo_epi8(digits, zero), _mm_setr_epi16(0, 1000, 0, 100, 10, 1, 100, 10));
+	__m128i high = _mm_madd_epi16(_mm_unpackhi_epi8(digits, zero), _mm_setr_epi16(1, 0, 0, 10, 1, 0, 0, 0));
+	int sums[8];
+	_mm_storeu_si128((__m128i*)sums, low);
+	_mm_storeu_si128((__m128i*)(sums + 4), high);
+	mantissa = (sums[0] + sums[1] + sums[2]) * 1000L + sums[3] + sums[4];
+	exponent = sums[5] + sums[6];
+#else
+	static const int digitColumns[9] = {1, 3, 4, 5, 6, 7, 8, 11, 12};
+	if (field[2] != '.' || field[9] != 'E' || field[13] != ' ' || field[14] != ' ' || field[15] != ' ') {
+		return false;
+	}
+	for (int i = 0; i < 9; i++) {
+		if (field[digitColumns[i]] < '0' || field[digitColumns[i]] > '9') {
+			return false;
+		}
+	}
+	mantissa = 0;
+	for (int i = 0; i < 7; i++) {
+		mantissa = mantissa * 10 + (field[digitColumns[i]] - '0');
+	}
+	exponent = (field[11] - '0') * 10 + (field[12] - '0');
+#endif
+	if (field[10] == '-') {
+		exponent = -exponent;
+	}
+	exponent -= PUNCH_MANTISSA_DECIMALS;
+	if (exponent < -22 || exponent > 22) {
+		return false;
+	}
+	value = (double)mantissa;
+	if (exponent < 0) {
+		value /= powers[-exponent];
+	} else {
+		value *= powers[exponent];
+	}
+	if (field[0] == '-') {
+		value = -value;
+	}
+	return true;
+}
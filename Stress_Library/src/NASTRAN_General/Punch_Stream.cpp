@@ -0,0 +1,35 @@
+/**
+ *
+ * @file		Punch_Stream.cpp
+ * @author		Matt Guimarey
+ * @date		17/10/2026
+ * @version		1.0
+ *
+ * This class defines a set of results files opened to be read one subcase at a time
+ *
+ */
+
+#include "NASTRAN_General/Punch_Stream.h"
+#include "NASTRAN_General/Punch_Index.h"
+
+#include <string>
+#include <vector>
+#include <memory>
+
+Punch_Stream::Punch_Stream()
+{
+
+}
+
+Punch_Stream::~Punch_Stream()
+{
+
+}
+
+void Punch_Stream::clear()
+{
+	fileNames.clear();
+	indexes.clear();
+	op2Indexes.clear();
+	subcases.clear();
+}
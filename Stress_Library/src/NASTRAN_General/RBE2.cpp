@@ -11,6 +11,11 @@
 
 #include "NASTRAN_General/RBE2.h"
 #include "NASTRAN_General/GRID.h"
+#include "NASTRAN_General/BDF_Line.h"
+#include "NASTRAN_General/BDF_Tokenizer.h"
+#include "NASTRAN_General/BDF_Field.h"
+#include "IO/Binary_Writer.h"
+#include "IO/Binary_Reader.h"
 
 #include <iostream>
 #include <vector>
@@ -26,11 +31,11 @@ RBE2::RBE2()
 /**
  *	@brief	Constructor also parsing Bulk Data File data, runs parse_BDF_data
  *
- *	@param	BDF_Data, a string vector containing Bulk Data File input lines
+ *	@param	BDF_Data, a BDF_Line vector of the Bulk Data File input lines
  * 	@param 	LongFormatFlag, a boolean flagging format type
  */
 
-RBE2::RBE2(std::vector<std::string> BDF_Data, bool LongFormatFlag)
+RBE2::RBE2(std::vector<BDF_Line> &BDF_Data, bool LongFormatFlag)
 {
 	parseBDFData(BDF_Data, LongFormatFlag);
 }
@@ -45,38 +50,26 @@ RBE2::~RBE2()
 			File has a short and a long format recognised by NASTRAN, the flag 
 			modifies how the input data is parsed for these occurences.
  *
- *	@param	BDF_Data, a string vector containing Bulk Data File input lines
+ *	@param	BDF_Data, a BDF_Line vector of the Bulk Data File input lines
  * 	@param 	LongFormatFlag, a boolean flagging format type
  *	@return	void
  */
 
-void RBE2::parseBDFData(std::vector<std::string> BDF_Data, bool LongFormatFlag)
+void RBE2::parseBDFData(std::vector<BDF_Line> &BDF_Data, bool LongFormatFlag)
 {
-	std::vector<std::string> LineData;	///< String vector to store seperated line entries for parsing
-	if (!LongFormatFlag) {
-		// Short Format, data fields every 8 characters (80 chars max)
-		for (int i = 0; i < BDF_Data.size(); i++) {
-			for (int j = 8; j < 72; j += 8) {
-				LineData.push_back(BDF_Data[i].substr(j, 8));
-			}
-		}
-	} else {
-		// Long Format, data fields every 16 characters after inital 8 characters (80 chars max)
-		for (int i = 0; i < BDF_Data.size(); i++) {
-			for (int j = 8; j < 72; j += 16) {
-				LineData.push_back(BDF_Data[i].substr(j, 8));
-			}
-		}	
-	}
+	// Split the card into fixed width fields, no data is copied
+	BDF_Tokenizer fields(BDF_Data, LongFormatFlag);
+	// Thermal expansion coefficient defaults to 0.0 when ALPHA is blank
+	pThermal = 0.0;
 	// Parse long array data, RBE2_ID, Ind Node and DOF
-	for (int i = 0; i < 3; i++) { pLongData[i] = atol(LineData[i].c_str()); }
-	for (int i = 3; i < LineData.size(); i++) {
-		std::string str = check_exp(LineData[i]);
-		if (str.compare("") != 0) {
-			if (checkReal(str)) {
-				pThermal = atof(str.c_str());
+	for (int i = 0; i < 3; i++) { pLongData[i] = fields.field(i).to_long(); }
+	for (std::size_t i = 3; i < fields.size(); i++) {
+		BDF_Field field = fields.field(i);
+		if (!field.is_blank()) {
+			if (field.is_real()) {
+				pThermal = field.to_double();
 			} else {
-				pDependantNodes.push_back(atol(str.c_str()));
+				pDependantNodes.push_back(field.to_long());
 			}
 		}
 	}
@@ -152,35 +145,16 @@ unsigned long RBE2::operator[](unsigned int i)
 	}
 }
 
-std::string RBE2::check_exp(std::string& str)
+void RBE2::writeSnapshot(Binary_Writer &writer)
 {
-    std::size_t first = str.find_first_not_of(' ');
-    if (first == std::string::npos)
-        return "";
-    std::size_t last = str.find_last_not_of(' ');
-	std::string tempStr = str.substr(first, (last-first+1));
-    // Check for NASTRAN exponent
-	std::size_t exp = tempStr.find_first_of('-', 1);
-	if (exp == std::string::npos) {
-		exp = tempStr.find_first_of('+', 1);
-	}
-	// Insert 'E' if exponent is found
-	if (exp != std::string::npos) {
-		std::size_t posEbig = tempStr.find_first_of('E');
-		std::size_t posEsma = tempStr.find_first_of('e');
-		if (posEbig == std::string::npos && posEsma == std::string::npos) {
-			tempStr.insert(exp, "E");
-		}
-	}
-	return tempStr;
+	for (int i = 0; i < 3; i++) { writer.write_ulong(pLongData[i]); }
+	writer.write_ulongs(pDependantNodes);
+	writer.write_double(pThermal);
 }
 
-bool RBE2::checkReal(std::string &str)
+void RBE2::readSnapshot(Binary_Reader &reader)
 {
-	std::size_t found = str.find_first_of('.');
-	if (found == std::string::npos) {
-		return false;
-	} else {
-		return true;
-	}
+	for (int i = 0; i < 3; i++) { pLongData[i] = reader.read_ulong(); }
+	reader.read_ulongs(pDependantNodes);
+	pThermal = reader.read_double();
 }
@@ -11,6 +11,11 @@
 
 #include "NASTRAN_General/RBE3.h"
 #include "NASTRAN_General/GRID.h"
+#include "NASTRAN_General/BDF_Line.h"
+#include "NASTRAN_General/BDF_Tokenizer.h"
+#include "NASTRAN_General/BDF_Field.h"
+#include "IO/Binary_Writer.h"
+#include "IO/Binary_Reader.h"
 
 #include <iostream>
 #include <vector>
@@ -26,11 +31,11 @@ RBE3::RBE3()
 /**
  *	@brief	Constructor also parsing Bulk Data File data, runs parse_BDF_data
  *
- *	@param	BDF_Data, a string vector containing Bulk Data File input lines
+ *	@param	BDF_Data, a BDF_Line vector of the Bulk Data File input lines
  * 	@param 	LongFormatFlag, a boolean flagging format type
  */
 
-RBE3::RBE3(std::vector<std::string> BDF_Data, bool LongFormatFlag)
+RBE3::RBE3(std::vector<BDF_Line> &BDF_Data, bool LongFormatFlag)
 {
 	parseBDFData(BDF_Data, LongFormatFlag);
 }
@@ -45,50 +50,38 @@ RBE3::~RBE3()
 			File has a short and a long format recognised by NASTRAN, the flag 
 			modifies how the input data is parsed for these occurences.
  *
- *	@param	BDF_Data, a string vector containing Bulk Data File input lines
+ *	@param	BDF_Data, a BDF_Line vector of the Bulk Data File input lines
  * 	@param 	LongFormatFlag, a boolean flagging format type
  *	@return	void
  */
 
-void RBE3::parseBDFData(std::vector<std::string> BDF_Data, bool LongFormatFlag)
+void RBE3::parseBDFData(std::vector<BDF_Line> &BDF_Data, bool LongFormatFlag)
 {
-	std::vector<std::string> LineData;	///< String vector to store separated line entries for parsing
-	if (!LongFormatFlag) {
-		// Short Format, data fields every 8 characters (80 chars max)
-		for (int i = 0; i < BDF_Data.size(); i++) {
-			for (int j = 8; j < 72; j += 8) {
-				LineData.push_back(BDF_Data[i].substr(j, 8));
-			}
-		}
-	} else {
-		// Long Format, data fields every 16 characters after initial 8 characters (80 chars max)
-		for (int i = 0; i < BDF_Data.size(); i++) {
-			for (int j = 8; j < 72; j += 16) {
-				LineData.push_back(BDF_Data[i].substr(j, 8));
-			}
-		}	
-	}
+	// Split the card into fixed width fields, no data is copied
+	BDF_Tokenizer fields(BDF_Data, LongFormatFlag);
+	// Thermal expansion coefficient defaults to 0.0 when ALPHA is blank
+	pThermal = 0.0;
 	// Parse long array data, RBE3_ID, REFGRID and REFC
-	pLongData[0] = atol(LineData[0].c_str());
-	for (int i = 2; i < 4; i++) { pLongData[i] = atol(LineData[i].c_str()); }
+	pLongData[0] = fields.field(0).to_long();
+	for (int i = 2; i < 4; i++) { pLongData[i - 1] = fields.field(i).to_long(); }
 	// Parse independent nodes
 	bool um = false, CTE = false, DOF_flag = false;
 	double weight_factor = 0.0;
 	unsigned long DOF = 0;
-	for (int i = 4; i < LineData.size(); i++) {
-		std::string str = check_exp(LineData[i]);
+	for (std::size_t i = 4; i < fields.size(); i++) {
+		BDF_Field field = fields.field(i);
 		if (CTE) {
-			pThermal = atof(str.c_str());
+			pThermal = field.to_double();
 			CTE = false;
 			continue;
 		}
-		if (str.compare("ALPHA") == 0) {
+		if (field.compare("ALPHA")) {
 			CTE = true;
 			um = false;
 			DOF_flag = false;
 			continue;
 		}
-		if (str.compare("") == 0) {
+		if (field.is_blank()) {
 			CTE = false;
 			um = false;
 			DOF_flag = false;
@@ -97,32 +90,32 @@ void RBE3::parseBDFData(std::vector<std::string> BDF_Data, bool LongFormatFlag)
 		if (um) {
 			if (DOF_flag) {
 				DOF_flag = false;
-				pDOFs.push_back(atol(str.c_str()));
+				pDOFs.push_back(field.to_long());
 				continue;
 			} else {
 				DOF_flag = true;
-				pIndependantNodes.push_back(atol(str.c_str()));
+				pIndependantNodes.push_back(field.to_long());
 				continue;
 			}
 		}
-		if (str.compare("UM") == 0) {
+		if (field.compare("UM")) {
 			um = true;
 			continue;
 		}
-		if (str.compare("") == 0) {
+		if (field.is_blank()) {
 			um = DOF_flag = CTE = false;
 			continue;
 		}
-		if (checkReal(str)) {
-			pWeightingFactors.push_back(atof(str.c_str()));
+		if (field.is_real()) {
+			pWeightingFactors.push_back(field.to_double());
 			DOF_flag = true;
 			continue;
 		} else {
 			if (DOF_flag) {
-				pDOFs.push_back(atol(str.c_str()));
+				pDOFs.push_back(field.to_long());
 				DOF_flag = false;
 			} else {
-				pIndependantNodes.push_back(atol(str.c_str()));
+				pIndependantNodes.push_back(field.to_long());
 				continue;				
 			}
 
@@ -200,35 +193,20 @@ unsigned long RBE3::operator[](unsigned int i)
 	}
 }
 
-std::string RBE3::check_exp(std::string& str)
+void RBE3::writeSnapshot(Binary_Writer &writer)
 {
-    std::size_t first = str.find_first_not_of(' ');
-    if (first == std::string::npos)
-        return "";
-    std::size_t last = str.find_last_not_of(' ');
-	std::string tempStr = str.substr(first, (last-first+1));
-    // Check for NASTRAN exponent
-	std::size_t exp = tempStr.find_first_of('-', 1);
-	if (exp == std::string::npos) {
-		exp = tempStr.find_first_of('+', 1);
-	}
-	// Insert 'E' if exponent is found
-	if (exp != std::string::npos) {
-		std::size_t posEbig = tempStr.find_first_of('E');
-		std::size_t posEsma = tempStr.find_first_of('e');
-		if (posEbig == std::string::npos && posEsma == std::string::npos) {
-			tempStr.insert(exp, "E");
-		}
-	}
-	return tempStr;
+	for (int i = 0; i < 3; i++) { writer.write_ulong(pLongData[i]); }
+	writer.write_ulongs(pIndependantNodes);
+	writer.write_ulongs(pDOFs);
+	writer.write_doubles(pWeightingFactors);
+	writer.write_double(pThermal);
 }
 
-bool RBE3::checkReal(std::string &str)
+void RBE3::readSnapshot(Binary_Reader &reader)
 {
-	std::size_t found = str.find_first_of('.');
-	if (found == std::string::npos) {
-		return false;
-	} else {
-		return true;
-	}
+	for (int i = 0; i < 3; i++) { pLongData[i] = reader.read_ulong(); }
+	reader.read_ulongs(pIndependantNodes);
+	reader.read_ulongs(pDOFs);
+	reader.read_doubles(pWeightingFactors);
+	pThermal = reader.read_double();
 }
@@ -0,0 +1,122 @@
+/**
+ *
+ * @file		Result_Store.cpp
+ * @author		Matt Guimarey
+ * @date		17/10/2026
+ * @version		1.0
+ *
+ * This class stores the punch file results of one element type in dense arrays
+ *
+ */
+
+#include "NASTRAN_General/Result_Store.h"
+
+#include <vector>
+#include <map>
+#include <cstddef>
+
+Result_Store::Result_Store()
+{
+	pComponents = 0;
+	pElements = 0;
+}
+
+Result_Store::Result_Store(int Components)
+{
+	pComponents = Components;
+	pElements = 0;
+}
+
+Result_Store::~Result_Store()
+{
+
+}
+
+unsigned long Result_Store::add_element()
+{
+	return pElements++;
+}
+
+/**
+ *	@brief	Adds the result values of an element for a subcase. The subcase is given the next
+ *			dense index the first time it is found, and its arrays are grown to cover every
+ *			element added so far when an element past their end is written. A result already
+ *			held for the element and subcase is kept.
+ *
+ *	@param	Index, the dense index of the element returned by add_element
+ * 	@param 	SubcaseID, unsigned long integer of the subcase ID
+ *	@param	values, a double array of pComponents result values
+ *	@param	flag, a bool stored with the values
+ *	@return	void
+ */
+
+void Result_Store::add_result(unsigned long Index, unsigned long SubcaseID, const double* values, bool flag)
+{
+	std::map<unsigned long, unsigned long>::iterator subcase_it = pSubcaseIndex.find(SubcaseID);
+	if (subcase_it == pSubcaseIndex.end()) {
+		subcase_it = pSubcaseIndex.insert(std::pair<unsigned long, unsigned long> (SubcaseID, pValues.size())).first;
+		pValues.push_back(std::vector<double>());
+		pFlags.push_back(std::vector<unsigned char>());
+	}
+	std::vector<unsigned char> &flags = pFlags[subcase_it->second];
+	std::vector<double> &subcaseValues = pValues[subcase_it->second];
+	if (Index >= flags.size()) {
+		flags.resize(pElements > Index ? pElements : Index + 1, 0);
+		subcaseValues.resize(flags.size() * pComponents, 0.0);
+	}
+	if (flags[Index] != 0) {
+		return;
+	}
+	flags[Index] = flag ? 2 : 1;
+	for (int i = 0; i < pComponents; i++) {
+		subcaseValues[Index * pComponents + i] = values[i];
+	}
+}
+
+/**
+ *	@brief	Returns the result values of an element for a subcase.
+ *
+ *	@param	Index, the dense index of the element returned by add_element
+ * 	@param 	SubcaseID, unsigned long integer of the subcase ID
+ *	@param	flag, set to the flag stored with the values
+ *	@return	const double*, pointer to pComponents result values, NULL if no result was added
+ */
+
+const double* Result_Store::get_result(unsigned long Index, unsigned long SubcaseID, bool &flag) const
+{
+	std::map<unsigned long, unsigned long>::const_iterator subcase_it = pSubcaseIndex.find(SubcaseID);
+	if (subcase_it == pSubcaseIndex.end()) {
+		return NULL;
+	}
+	const std::vector<unsigned char> &flags = pFlags[subcase_it->second];
+	if (Index >= flags.size() || flags[Index] == 0) {
+		return NULL;
+	}
+	flag = flags[Index] == 2;
+	return &pValues[subcase_it->second][Index * pComponents];
+}
+
+unsigned long Result_Store::element_count() const
+{
+	return pElements;
+}
+
+unsigned long Result_Store::subcase_count() const
+{
+	return pSubcaseIndex.size();
+}
+
+void Result_Store::clear()
+{
+	pElements = 0;
+	pSubcaseIndex.clear();
+	pValues.clear();
+	pFlags.clear();
+}
+
+void Result_Store::clear_results()
+{
+	pSubcaseIndex.clear();
+	pValues.clear();
+	pFlags.clear();
+}
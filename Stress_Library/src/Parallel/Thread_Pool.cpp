@@ -0,0 +1,128 @@
+/**
+ *
+ * @file		Thread_Pool.cpp
+ * @author		Matt Guimarey
+ * @date		17/10/2026
+ * @version		1.0
+ *
+ * This class defines a fixed size pool of worker threads fed from a task queue
+ *
+ */
+
+#include "Parallel/Thread_Pool.h"
+
+#include <vector>
+#include <deque>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+
+Thread_Pool::Thread_Pool()
+{
+	start(0);
+}
+
+Thread_Pool::Thread_Pool(unsigned int threadCount)
+{
+	start(threadCount);
+}
+
+Thread_Pool::~Thread_Pool()
+{
+	{
+		std::unique_lock<std::mutex> lock(pMutex);
+		pStop = true;
+	}
+	pTaskReady.notify_all();
+	for (int i = 0; i < pWorkers.size(); i++) {
+		pWorkers[i].join();
+	}
+}
+
+/**
+ *	@brief	Starts the worker threads. A thread count of zero uses the number of hardware
+ *			threads reported by the system, at least one worker is always started.
+ *
+ *	@param	threadCount, the number of worker threads to start
+ *	@return	void
+ */
+
+void Thread_Pool::start(unsigned int threadCount)
+{
+	pActive = 0;
+	pStop = false;
+	if (threadCount == 0) {
+		threadCount = std::thread::hardware_concurrency();
+	}
+	if (threadCount == 0) {
+		threadCount = 1;
+	}
+	for (unsigned int i = 0; i < threadCount; i++) {
+		pWorkers.push_back(std::thread(&Thread_Pool::run_worker, this));
+	}
+}
+
+void Thread_Pool::add_task(std::function<void()> task)
+{
+	{
+		std::unique_lock<std::mutex> lock(pMutex);
+		pTasks.push_back(task);
+	}
+	pTaskReady.notify_one();
+}
+
+/**
+ *	@brief	Blocks the calling thread until every queued task, including tasks queued by
+ *			other tasks, has finished.
+ *
+ *	@return	void
+ */
+
+void Thread_Pool::wait()
+{
+	std::unique_lock<std::mutex> lock(pMutex);
+	while (!pTasks.empty() || pActive > 0) {
+		pTasksDone.wait(lock);
+	}
+}
+
+unsigned int Thread_Pool::size()
+{
+	return pWorkers.size();
+}
+
+/**
+ *	@brief	Worker loop, takes tasks from the front of the queue until the pool is stopped
+ *			and the queue is empty.
+ *
+ *	@return	void
+ */
+
+void Thread_Pool::run_worker()
+{
+	std::function<void()> task;
+	while (true) {
+		{
+			std::unique_lock<std::mutex> lock(pMutex);
+			while (!pStop && pTasks.empty()) {
+				pTaskReady.wait(lock);
+			}
+			if (pTasks.empty()) {
+				// Stopping and nothing left to run
+				return;
+			}
+			task = pTasks.front();
+			pTasks.pop_front();
+			pActive++;
+		}
+		task();
+		{
+			std::unique_lock<std::mutex> lock(pMutex);
+			pActive--;
+			if (pActive == 0 && pTasks.empty()) {
+				pTasksDone.notify_all();
+			}
+		}
+	}
+}